@@ -0,0 +1,189 @@
+/*******************************************************************************************************************
+ * File Name: Benchmark.c
+ * Date: 16/10/2026
+ * Driver: Benchmark Firmware of the Drivers Entry Points (simavr)
+ * Author: Youssef Zaki
+ *
+ * Built by the Makefile of this folder (STOPWATCH_BENCHMARK defined) with the drivers and the application
+ * (its main() renamed, so its ISRs are the measured ones), then executed by Benchmark_Runner in simavr.
+ * The Eclipse project compiles this file to nothing.
+ * The interrupts stay disabled (and the timers stopped) while measuring: the ISRs are called like functions,
+ * their RETI sets the I-bit, so it is cleared again after every call outside the measured part.
+ * The tick and the display ISRs run with the call backs of the application: StopWatch_Tick() with the software
+ * timers of the application armed, and the refresh of the multiplexed display.
+ ******************************************************************************************************************/
+#ifdef STOPWATCH_BENCHMARK
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "Benchmark.h"
+#include "GPIO.h"
+#include "INT.h"
+#include "TIMER0.h"
+#include "TIMER1.h"
+#include "SevenSegment.h"
+#include "StopWatch.h"
+
+/* The ISRs are called directly */
+void __vector_1(void);
+void __vector_2(void);
+void __vector_3(void);
+void __vector_7(void);
+void __vector_10(void);
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * The markers of the measured part, the runner stops at their first instruction:
+ * the id is in r24 at the beginning of Benchmark_Begin().
+ */
+void Benchmark_Begin(uint8 id) __attribute__((noinline, used));
+void Benchmark_End(void) __attribute__((noinline, used));
+
+void Benchmark_Begin(uint8 id)
+{
+	__asm__ __volatile__ ("" : : "r" (id) : "memory");
+}
+
+void Benchmark_End(void)
+{
+	__asm__ __volatile__ ("" : : : "memory");
+}
+
+/* Software timers call back, the timers are armed like in the application */
+static void Benchmark_Nothing(void)
+{
+}
+
+/****************************************************************************************
+ *                                      Main Function                                   *
+ ****************************************************************************************/
+int main(void)
+{
+	Timer1_ConfigType timer1Config = {0, TIMER1_TICK_COMPARE_VALUE, TIMER1_TICK_PRESCALER, CTC_4};
+	uint16 call;
+
+	cli();
+
+	for (call = 0; call < 16; call++)
+	{
+		Benchmark_Begin(Benchmark_Overhead);
+		Benchmark_End();
+	}
+
+	for (call = 0; call < 16; call++)
+	{
+		Benchmark_Begin(Benchmark_GPIO_WritePin);
+		GPIO_WritePin(PORTA_ID, (uint8)(call & 0x07), (uint8)(call >> 3));
+		Benchmark_End();
+	}
+
+	for (call = 0; call < 16; call++)
+	{
+		Benchmark_Begin(Benchmark_GPIO_SetupPinDirection);
+		GPIO_SetupPinDirection(PORTB_ID, (uint8)(call & 0x07), (uint8)(call >> 3));
+		Benchmark_End();
+	}
+
+	SevenSegment_Init();
+	for (call = 0; call < 10; call++)
+	{
+#if (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITHOUT_DECODER)
+		Benchmark_Begin(Benchmark_SevenSegment_Display);
+		SevenSegment_Display_Without_Decoder((uint8)call);
+#else
+		Benchmark_Begin(Benchmark_SevenSegment_Decoder);
+		SevenSegment_Display_With_Decoder((uint8)call);
+#endif
+		Benchmark_End();
+	}
+
+	SevenSegment_Multiplex_Init();
+	for (call = 0; call < 60; call++)
+	{
+		Benchmark_Begin(Benchmark_SevenSegment_Refresh);
+		SevenSegment_Multiplex_Refresh();
+		Benchmark_End();
+	}
+
+	/* The timer is stopped again after every call, so its interrupt never comes */
+	for (call = 0; call < 4; call++)
+	{
+		Benchmark_Begin(Benchmark_Timer1_Init);
+		Timer1_NonPWm_Mode_Init(&timer1Config);
+		Benchmark_End();
+		TCCR1B = 0;
+		TIMSK = 0;
+	}
+
+	for (call = 0; call < 4; call++)
+	{
+		Benchmark_Begin(Benchmark_INT0_Init);
+		INT0_Init(INT0_FALLING_EDGE);
+		Benchmark_End();
+		GICR = 0;
+	}
+
+	/* The time base of the application: the tick counts channel 0 and runs the software timers */
+	StopWatch_Init(StopWatch_HH_MM_SS);
+	for (call = 0; call < 1000; call++)
+	{
+		Benchmark_Begin(Benchmark_StopWatch_Tick);
+		StopWatch_Tick();
+		Benchmark_End();
+	}
+
+	Timer1_SetCallBack(StopWatch_Tick);
+	Timer1_SoftTimer_Start(100, Timer1_Periodic, Benchmark_Nothing);
+	Timer1_SoftTimer_Start(100, Timer1_Periodic, Benchmark_Nothing);
+	Timer1_SoftTimer_Start(60000, Timer1_Periodic, Benchmark_Nothing);
+	Timer1_SoftTimer_Start(60000, Timer1_OneShot, Benchmark_Nothing);
+	for (call = 0; call < 1000; call++)
+	{
+		Benchmark_Begin(Benchmark_Tick_ISR);
+		__vector_7();
+		Benchmark_End();
+		cli();
+	}
+
+	Timer0_SetCallBack(SevenSegment_Multiplex_Refresh);
+	for (call = 0; call < 60; call++)
+	{
+		Benchmark_Begin(Benchmark_Display_ISR);
+		__vector_10();
+		Benchmark_End();
+		cli();
+	}
+
+	/* The buttons ISRs disable their interrupt and post their event (the queue is emptied by nobody) */
+	for (call = 0; call < 4; call++)
+	{
+		Benchmark_Begin(Benchmark_Reset_ISR);
+		__vector_1();
+		Benchmark_End();
+		cli();
+
+		Benchmark_Begin(Benchmark_Pause_ISR);
+		__vector_2();
+		Benchmark_End();
+		cli();
+
+		Benchmark_Begin(Benchmark_Resume_ISR);
+		__vector_3();
+		Benchmark_End();
+		cli();
+	}
+
+	/* Sleeping with the interrupts disabled ends the simulation */
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+
+	return 0;
+}
+
+#endif /* STOPWATCH_BENCHMARK */
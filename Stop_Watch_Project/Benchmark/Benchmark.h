@@ -0,0 +1,53 @@
+/*******************************************************************************************************************
+ * File Name: Benchmark.h
+ * Date: 16/10/2026
+ * Driver: Benchmark Entry Points Shared by the Benchmark Firmware and its simavr Runner
+ * Author: Youssef Zaki
+ *
+ * The firmware (Benchmark.c, built by avr-gcc) calls every entry point between Benchmark_Begin(id) and
+ * Benchmark_End(). The runner (Benchmark_Runner.c, built for the PC) executes the firmware in simavr, it reads
+ * the cycle counter when the program counter reaches these two functions and the lowest stack pointer between them.
+ ******************************************************************************************************************/
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * BENCHMARK_ENTRY(id, name, symbol):
+ * name: the entry point in the results, symbol: its function in the ELF file (its size is the flash bytes).
+ * Every entry is measured for several calls (the tick for a whole second of ticks, so every carry is included).
+ * Benchmark_Overhead measures an empty Begin/End pair, it is subtracted from the cycles of the other entries.
+ * Only the 7-segment display function of the configured SEVEN_SEGMENT_MODE is built, so only it is measured.
+ */
+#define BENCHMARK_ENTRIES \
+	BENCHMARK_ENTRY(Benchmark_Overhead,                     "overhead",                             "") \
+	BENCHMARK_ENTRY(Benchmark_GPIO_WritePin,                "GPIO_WritePin",                        "GPIO_WritePin") \
+	BENCHMARK_ENTRY(Benchmark_GPIO_SetupPinDirection,       "GPIO_SetupPinDirection",               "GPIO_SetupPinDirection") \
+	BENCHMARK_ENTRY(Benchmark_SevenSegment_Display,         "SevenSegment_Display_Without_Decoder", "SevenSegment_Display_Without_Decoder") \
+	BENCHMARK_ENTRY(Benchmark_SevenSegment_Decoder,         "SevenSegment_Display_With_Decoder",    "SevenSegment_Display_With_Decoder") \
+	BENCHMARK_ENTRY(Benchmark_SevenSegment_Refresh,         "SevenSegment_Multiplex_Refresh",       "SevenSegment_Multiplex_Refresh") \
+	BENCHMARK_ENTRY(Benchmark_Timer1_Init,                  "Timer1_NonPWm_Mode_Init",              "Timer1_NonPWm_Mode_Init") \
+	BENCHMARK_ENTRY(Benchmark_INT0_Init,                    "INT0_Init",                            "INT0_Init") \
+	BENCHMARK_ENTRY(Benchmark_StopWatch_Tick,               "StopWatch_Tick",                       "StopWatch_Tick") \
+	BENCHMARK_ENTRY(Benchmark_Tick_ISR,                     "TIMER1_COMPA_vect",                    "__vector_7") \
+	BENCHMARK_ENTRY(Benchmark_Display_ISR,                  "TIMER0_COMP_vect",                     "__vector_10") \
+	BENCHMARK_ENTRY(Benchmark_Reset_ISR,                    "INT0_vect",                            "__vector_1") \
+	BENCHMARK_ENTRY(Benchmark_Pause_ISR,                    "INT1_vect",                            "__vector_2") \
+	BENCHMARK_ENTRY(Benchmark_Resume_ISR,                   "INT2_vect",                            "__vector_3")
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+#define BENCHMARK_ENTRY(id, name, symbol)          id,
+typedef enum
+{
+	BENCHMARK_ENTRIES
+	Benchmark_NumOfEntries
+}Benchmark_EntryId;
+#undef BENCHMARK_ENTRY
+
+#endif /* BENCHMARK_H_ */
@@ -0,0 +1,39 @@
+#!/bin/sh
+################################################################################################################
+# File Name: Benchmark_Compare.sh
+# Date: 16/10/2026
+# Description: Compare the benchmark results with the baseline (both entry,calls,cycles_mean,cycles_max,
+#              stack_bytes,flash_bytes), print every change and fail if an entry is slower (more than the
+#              tolerance in percent), bigger, uses more stack, or is missing from the results.
+#              An entry which is not in the baseline yet is reported as new and does not fail.
+#              A baseline with no entry can not detect anything: the comparison fails until one is recorded
+#              (make baseline, from a simavr run of the version the changes are measured against).
+# Usage: Benchmark_Compare.sh <baseline.csv> <results.csv> [tolerance percent]
+################################################################################################################
+
+if [ $# -lt 2 ] || [ ! -f "$1" ] || [ ! -f "$2" ]; then
+	echo "usage: $0 <baseline.csv> <results.csv> [tolerance percent]" >&2
+	exit 2
+fi
+
+if [ "$(awk 'NR > 1 && NF > 0' "$1" | wc -l)" -eq 0 ]; then
+	echo "$1 has no entry: NOT ENFORCING anything, record a baseline first (make baseline)" >&2
+	exit 3
+fi
+
+awk -F, -v tolerance="${3:-0}" '
+FNR == 1 { next }
+FNR == NR { base[$1] = $0; next }
+{
+	seen[$1] = 1
+	if (!($1 in base)) { printf("%-40s new: %s cycles (max %s), %s stack bytes, %s flash bytes\n", $1, $3, $4, $5, $6); next }
+	split(base[$1], b, ",")
+	status = "ok"
+	if (($3 > b[3] * (1 + tolerance / 100)) || ($4 > b[4] * (1 + tolerance / 100)) || ($5 > b[5]) || ($6 > b[6])) { status = "REGRESSION"; failed = 1 }
+	else if (($3 != b[3]) || ($4 != b[4]) || ($5 != b[5]) || ($6 != b[6])) { status = "changed" }
+	printf("%-40s %-10s cycles %s -> %s (max %s -> %s), stack %s -> %s, flash %s -> %s\n", $1, status, b[3], $3, b[4], $4, b[5], $5, b[6], $6)
+}
+END {
+	for (entry in base) if (!(entry in seen)) { printf("%-40s MISSING from the results\n", entry); failed = 1 }
+	exit failed
+}' "$1" "$2"
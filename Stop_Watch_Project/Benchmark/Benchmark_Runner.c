@@ -0,0 +1,222 @@
+/*******************************************************************************************************************
+ * File Name: Benchmark_Runner.c
+ * Date: 16/10/2026
+ * Driver: simavr Runner of the Benchmark Firmware (PC Program)
+ * Author: Youssef Zaki
+ *
+ * Usage: Benchmark_Runner <firmware.elf> <symbols.txt>   (symbols.txt: the output of avr-nm -S <firmware.elf>)
+ * The firmware is executed instruction by instruction on an ATmega32 of simavr, the cycle counter is read when
+ * the program counter reaches Benchmark_Begin() and Benchmark_End() (see Benchmark.h), the stack pointer is
+ * followed between them. One CSV line is printed for every measured entry point:
+ *     entry,calls,cycles_mean,cycles_max,stack_bytes,flash_bytes
+ * cycles: cycles of one call (argument setup and call included, the empty Begin/End pair subtracted).
+ * stack_bytes: deepest stack use of one call below the stack pointer of the caller (return address included).
+ * flash_bytes: size of the function itself (the functions it calls are separate entries).
+ * The Eclipse project compiles this file to nothing.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "Standard_Types.h"
+#include "Benchmark.h"
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* The simulation is stopped if the firmware does not end by itself (it is stuck) */
+#define BENCHMARK_MAX_CYCLES                       100000000ULL
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+typedef struct
+{
+	const char * name;
+	const char * symbol;
+	uint32 calls;
+	uint64 cycles;
+	uint64 max_cycles;
+	uint16 stack;
+	uint32 flash;
+}Benchmark_ResultType;
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+#define BENCHMARK_ENTRY(id, name, symbol)          {name, symbol, 0, 0, 0, 0, 0},
+static Benchmark_ResultType g_results[Benchmark_NumOfEntries] = { BENCHMARK_ENTRIES };
+#undef BENCHMARK_ENTRY
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Read the avr-nm -S output: keep the flash size of every entry and the address of the two markers.
+ * The function will return FALSE if a marker is not found.
+ */
+static boolean Benchmark_ReadSymbols(const char * file, uint32 * begin, uint32 * end)
+{
+	FILE * symbols = fopen(file, "r");
+	char line[256];
+	char name[200];
+	char type;
+	unsigned long address;
+	unsigned long size;
+	uint8 id;
+
+	*begin = 0;
+	*end = 0;
+	if (symbols == NULL)
+	{
+		return FALSE;
+	}
+
+	while (fgets(line, sizeof(line), symbols) != NULL)
+	{
+		/* "address size type name", the symbols without a size have no size field */
+		if (sscanf(line, "%lx %lx %c %199s", &address, &size, &type, name) != 4)
+		{
+			size = 0;
+			if (sscanf(line, "%lx %c %199s", &address, &type, name) != 3)
+			{
+				continue;
+			}
+		}
+
+		if (strcmp(name, "Benchmark_Begin") == 0)
+		{
+			*begin = (uint32)address;
+		}
+		else if (strcmp(name, "Benchmark_End") == 0)
+		{
+			*end = (uint32)address;
+		}
+		for (id = 0; id < Benchmark_NumOfEntries; id++)
+		{
+			if ((g_results[id].symbol[0] != '\0') && (strcmp(name, g_results[id].symbol) == 0))
+			{
+				g_results[id].flash = (uint32)size;
+			}
+		}
+	}
+	fclose(symbols);
+	return ((*begin != 0) && (*end != 0)) ? TRUE : FALSE;
+}
+
+static uint16 Benchmark_StackPointer(const avr_t * avr)
+{
+	return (uint16)(avr -> data[R_SPL] | (avr -> data[R_SPH] << 8));
+}
+
+/****************************************************************************************
+ *                                      Main Function                                   *
+ ****************************************************************************************/
+int main(int argc, char * argv[])
+{
+	elf_firmware_t firmware;
+	avr_t * avr;
+	uint32 begin;
+	uint32 end;
+	uint8 id = 0;
+	boolean measuring = FALSE;
+	uint64 startCycle = 0;
+	uint16 callerStack = 0;
+	uint16 lowestStack = 0;
+	uint64 overhead;
+	uint64 cycles;
+	int state;
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: %s <firmware.elf> <symbols.txt>\n", argv[0]);
+		return 2;
+	}
+	if (Benchmark_ReadSymbols(argv[2], &begin, &end) == FALSE)
+	{
+		fprintf(stderr, "%s: Benchmark_Begin/Benchmark_End not found\n", argv[2]);
+		return 2;
+	}
+
+	memset(&firmware, 0, sizeof(firmware));
+	if (elf_read_firmware(argv[1], &firmware) != 0)
+	{
+		fprintf(stderr, "%s: can not be loaded\n", argv[1]);
+		return 2;
+	}
+	avr = avr_make_mcu_by_name("atmega32");
+	if (avr == NULL)
+	{
+		fprintf(stderr, "simavr has no atmega32\n");
+		return 2;
+	}
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+
+	do
+	{
+		if (avr -> pc == begin)
+		{
+			/* The entry id is the argument of Benchmark_Begin(), the return address is on the stack */
+			id = avr -> data[24];
+			measuring = (id < Benchmark_NumOfEntries) ? TRUE : FALSE;
+			startCycle = avr -> cycle;
+			callerStack = (uint16)(Benchmark_StackPointer(avr) + 2);
+			lowestStack = callerStack;
+		}
+		else if ((avr -> pc == end) && (measuring == TRUE))
+		{
+			cycles = avr -> cycle - startCycle;
+			g_results[id].calls++;
+			g_results[id].cycles += cycles;
+			if (cycles > g_results[id].max_cycles)
+			{
+				g_results[id].max_cycles = cycles;
+			}
+			if ((uint16)(callerStack - lowestStack) > g_results[id].stack)
+			{
+				g_results[id].stack = (uint16)(callerStack - lowestStack);
+			}
+			measuring = FALSE;
+		}
+
+		if ((measuring == TRUE) && (Benchmark_StackPointer(avr) < lowestStack))
+		{
+			lowestStack = Benchmark_StackPointer(avr);
+		}
+
+		state = avr_run(avr);
+	} while ((state != cpu_Done) && (state != cpu_Crashed) && (avr -> cycle < BENCHMARK_MAX_CYCLES));
+
+	if ((state != cpu_Done) || (g_results[Benchmark_Overhead].calls == 0))
+	{
+		fprintf(stderr, "%s: the firmware did not end normally (state %d, cycle %llu)\n", argv[1], state,
+		        (unsigned long long)avr -> cycle);
+		return 1;
+	}
+
+	/* The cycles of the empty Begin/End pair are not part of the entries */
+	overhead = g_results[Benchmark_Overhead].cycles / g_results[Benchmark_Overhead].calls;
+	printf("entry,calls,cycles_mean,cycles_max,stack_bytes,flash_bytes\n");
+	for (id = 0; id < Benchmark_NumOfEntries; id++)
+	{
+		if ((id == Benchmark_Overhead) || (g_results[id].calls == 0))
+		{
+			continue;
+		}
+		printf("%s,%lu,%llu,%llu,%u,%lu\n", g_results[id].name, (unsigned long)g_results[id].calls,
+		       (unsigned long long)((g_results[id].cycles / g_results[id].calls) - overhead),
+		       (unsigned long long)(g_results[id].max_cycles - overhead),
+		       g_results[id].stack, (unsigned long)g_results[id].flash);
+	}
+	return 0;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,270 @@
+/*******************************************************************************************************************
+ * File Name: Command.c
+ * Date: 16/10/2026
+ * Driver: Text Commands over UART Parser Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Command.h"
+#include "UART.h"
+#include <avr/pgmspace.h>
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Number of names in the table (Command_Invalid is not a name) */
+#define COMMAND_NUM_OF_NAMES                       7
+
+/* Longest name + 1 for the terminating null */
+#define COMMAND_NAME_SIZE                          7
+
+/* The parser states */
+#define COMMAND_STATE_NAME                         0
+#define COMMAND_STATE_ARGUMENT                     1
+#define COMMAND_STATE_END                          2
+#define COMMAND_STATE_ERROR                        3
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* The names in the order of Command_Type, in the flash memory */
+static const char g_commandNames[COMMAND_NUM_OF_NAMES][COMMAND_NAME_SIZE] PROGMEM =
+{
+	"start", "stop", "reset", "lap", "mode", "status", "bright"
+};
+
+/* Global variables to hold the address of the call back function in the application */
+static void (*g_callBackPtr)(Command_Type command, uint8 argument) = NULL_PTR;
+
+/*
+ * State of the line being received:
+ * g_candidates: bit n is set while the characters received so far match the name n.
+ * g_position: number of characters of the name received so far.
+ * g_argument: the decimal argument (COMMAND_NO_ARGUMENT until its first digit).
+ */
+static uint8 g_state = COMMAND_STATE_NAME;
+static uint8 g_candidates = (1 << COMMAND_NUM_OF_NAMES) - 1;
+static uint8 g_position = 0;
+static uint8 g_argument = COMMAND_NO_ARGUMENT;
+
+/* Received bytes dropped by the UART when the parser last looked (see Command_Process()) */
+static uint16 g_rxDropped = 0;
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * The function will return the only candidate whose name is exactly the received characters,
+ * or Command_Invalid if there is none.
+ */
+static Command_Type Command_Match(void)
+{
+	uint8 name;
+
+	for (name = 0; name < COMMAND_NUM_OF_NAMES; name++)
+	{
+		if ((g_candidates & (1 << name)) && (g_position < COMMAND_NAME_SIZE) &&
+		    (pgm_read_byte(&g_commandNames[name][g_position]) == '\0'))
+		{
+			/* The names are all different, so at most one of them ends here */
+			return (Command_Type)name;
+		}
+	}
+	return Command_Invalid;
+}
+
+/*
+ * Description:
+ * Start a new line.
+ */
+static void Command_Restart(void)
+{
+	g_state = COMMAND_STATE_NAME;
+	g_candidates = (1 << COMMAND_NUM_OF_NAMES) - 1;
+	g_position = 0;
+	g_argument = COMMAND_NO_ARGUMENT;
+}
+
+/*
+ * Description:
+ * A line is complete: give the command to the application and start a new line.
+ */
+static void Command_EndOfLine(void)
+{
+	Command_Type command = Command_Invalid;
+
+	if ((g_state == COMMAND_STATE_NAME) && (g_position == 0))
+	{
+		/* Empty line (e.g. the '\n' after '\r') */
+		return;
+	}
+
+	if (g_state == COMMAND_STATE_NAME)
+	{
+		command = Command_Match();
+	}
+	else if ((g_state == COMMAND_STATE_ARGUMENT) || (g_state == COMMAND_STATE_END))
+	{
+		/* The name was matched when its first space was received */
+		command = (Command_Type)g_position;
+	}
+
+	if (g_callBackPtr != NULL_PTR)
+	{
+		(*g_callBackPtr)(command, (command == Command_Invalid) ? COMMAND_NO_ARGUMENT : g_argument);
+	}
+	Command_Restart();
+}
+
+/*
+ * Description:
+ * Move the parser state with one received character.
+ */
+static void Command_Parse(uint8 character)
+{
+	uint8 name;
+
+	if ((character == '\r') || (character == '\n'))
+	{
+		Command_EndOfLine();
+		return;
+	}
+
+	if ((character >= 'A') && (character <= 'Z'))
+	{
+		character += 'a' - 'A';
+	}
+
+	switch (g_state)
+	{
+	case COMMAND_STATE_NAME:
+		if (character == ' ')
+		{
+			if (g_position != 0)
+			{
+				/* From now on g_position holds the matched command */
+				g_position = Command_Match();
+				g_state = (g_position == Command_Invalid) ? COMMAND_STATE_ERROR : COMMAND_STATE_ARGUMENT;
+			}
+		}
+		else if (g_position >= (COMMAND_NAME_SIZE - 1))
+		{
+			g_state = COMMAND_STATE_ERROR;
+		}
+		else
+		{
+			for (name = 0; name < COMMAND_NUM_OF_NAMES; name++)
+			{
+				if (pgm_read_byte(&g_commandNames[name][g_position]) != character)
+				{
+					g_candidates &= ~(1 << name);
+				}
+			}
+			g_position++;
+			if (g_candidates == 0)
+			{
+				g_state = COMMAND_STATE_ERROR;
+			}
+		}
+		break;
+
+	case COMMAND_STATE_ARGUMENT:
+		if ((character >= '0') && (character <= '9'))
+		{
+			if (g_argument == COMMAND_NO_ARGUMENT)
+			{
+				g_argument = 0;
+			}
+			if (g_argument > ((COMMAND_MAX_ARGUMENT - (character - '0')) / 10))
+			{
+				g_state = COMMAND_STATE_ERROR;
+			}
+			else
+			{
+				g_argument = (g_argument * 10) + (character - '0');
+			}
+		}
+		else if (character != ' ')
+		{
+			g_state = COMMAND_STATE_ERROR;
+		}
+		else if (g_argument != COMMAND_NO_ARGUMENT)
+		{
+			g_state = COMMAND_STATE_END;
+		}
+		break;
+
+	case COMMAND_STATE_END:
+		if (character != ' ')
+		{
+			/* Only one number is allowed after the name */
+			g_state = COMMAND_STATE_ERROR;
+		}
+		break;
+
+	default:
+		/* Ignore the rest of a bad line */
+		break;
+	}
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Forget any partially received command.
+ */
+void Command_Init(void)
+{
+	Command_Restart();
+	g_rxDropped = UART_GetRxDropped();
+}
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called by Command_Process() for every complete line with the command and its argument.
+ */
+void Command_SetCallBack(void(*a_ptr)(Command_Type command, uint8 argument))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description:
+ * Parse the bytes received by the UART since the last call, one byte at a time straight from the UART receive
+ * buffer (no line buffer), and call the call back at the end of every line. The state of an incomplete line is kept
+ * for the next call, so every byte is handled once. To be called from main() (a handler).
+ * If the UART dropped bytes since the last call, the line they belonged to is given as Command_Invalid.
+ */
+void Command_Process(void)
+{
+	uint16 dropped = UART_GetRxDropped();
+	uint8 count = UART_GetRxCount();
+	uint8 character;
+
+	/*
+	 * A byte is dropped when the receive buffer is full, so the bytes waiting now came before it:
+	 * parse them, then the line which continues after them has lost bytes and is ignored up to its end.
+	 */
+	while ((count > 0) && (UART_Receive(&character) == TRUE))
+	{
+		Command_Parse(character);
+		count--;
+	}
+	if (dropped != g_rxDropped)
+	{
+		g_rxDropped = dropped;
+		g_state = COMMAND_STATE_ERROR;
+	}
+
+	while (UART_Receive(&character) == TRUE)
+	{
+		Command_Parse(character);
+	}
+}
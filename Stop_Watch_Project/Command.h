@@ -0,0 +1,67 @@
+/*******************************************************************************************************************
+ * File Name: Command.h
+ * Date: 16/10/2026
+ * Driver: Text Commands over UART Parser Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * A command is one line: a name, optionally followed by spaces and a decimal argument (0 .. 254),
+ * ended by '\r' or '\n' (an empty line is ignored, so "\r\n" is accepted), upper or lower case, e.g. "stop 1".
+ */
+#define COMMAND_MAX_ARGUMENT                       254
+
+/* Argument given to the call back when the command has no argument */
+#define COMMAND_NO_ARGUMENT                        0xFF
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+typedef enum
+{
+	Command_Start,    /* "start [channel]" */
+	Command_Stop,     /* "stop [channel]" */
+	Command_Reset,    /* "reset [channel]" */
+	Command_Lap,      /* "lap [channel]" */
+	Command_Mode,     /* "mode <display mode>" */
+	Command_Status,   /* "status [channel]" */
+	Command_Bright,   /* "bright <display brightness level>" */
+	Command_Invalid   /* Unknown name, bad argument or too long line */
+}Command_Type;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Forget any partially received command.
+ */
+void Command_Init(void);
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called by Command_Process() for every complete line with the command and its argument.
+ */
+void Command_SetCallBack(void(*a_ptr)(Command_Type command, uint8 argument));
+
+/*
+ * Description:
+ * Parse the bytes received by the UART since the last call, one byte at a time straight from the UART receive
+ * buffer (no line buffer), and call the call back at the end of every line. The state of an incomplete line is kept
+ * for the next call, so every byte is handled once. To be called from main() (a handler).
+ * If the UART dropped bytes since the last call, the line they belonged to is given as Command_Invalid.
+ * Call it before the receive buffer is full (e.g. when it is half full), so a long line can not fill it.
+ */
+void Command_Process(void);
+
+#endif /* COMMAND_H_ */
@@ -0,0 +1,168 @@
+/*******************************************************************************************************************
+ * File Name: EEPROM.c
+ * Date: 16/10/2026
+ * Driver: ATmega32 Internal EEPROM Driver Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "EEPROM.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/eeprom.h>
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* The write in progress: next EEPROM address, next data byte and number of bytes left */
+static uint8 * volatile g_writeAddress = NULL_PTR;
+static const uint8 * volatile g_writeData = NULL_PTR;
+static volatile uint8 g_writeLength = 0;
+
+static volatile uint32 g_writtenBytes = 0;
+static volatile uint32 g_skippedBytes = 0;
+
+/* Global variables to hold the address of the call back function in the application */
+static void (* volatile g_callBackPtr)(void) = NULL_PTR;
+
+/****************************************************************************************
+ *                                    Interrupt Service Routines                        *
+ ****************************************************************************************/
+
+/*
+ * The EEPROM is ready (no write in progress): start writing the next byte, one byte per interrupt,
+ * so the ISR is short and the Timer1 tick (higher priority) is never delayed by more than one byte.
+ * The interrupt is a level one, it comes again directly after a byte which is not written.
+ */
+ISR(EE_RDY_vect)
+{
+	uint8 * address = g_writeAddress;
+	uint8 data;
+
+	if (g_writeLength == 0)
+	{
+		/* The last byte is completely written */
+		EECR &= ~(1 << EERIE);
+		if (g_callBackPtr != NULL_PTR)
+		{
+			(*g_callBackPtr)();
+		}
+		return;
+	}
+
+	data = *g_writeData;
+	if (eeprom_read_byte(address) != data)
+	{
+		/* The EEPROM is ready, so this does not wait */
+		eeprom_write_byte(address, data);
+		g_writtenBytes++;
+	}
+	else
+	{
+		g_skippedBytes++;
+	}
+
+	g_writeAddress = address + 1;
+	g_writeData++;
+	g_writeLength--;
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Read bytes from the EEPROM (the address is an EEMEM variable address).
+ * The function will return FALSE if a write is in progress (the EEPROM can not be read while it is written).
+ */
+boolean EEPROM_Read(const uint8 * address, uint8 * data, uint8 length)
+{
+	if (EEPROM_IsBusy() == TRUE)
+	{
+		return FALSE;
+	}
+
+	while (length != 0)
+	{
+		*data = eeprom_read_byte(address);
+		address++;
+		data++;
+		length--;
+	}
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Start writing bytes to the EEPROM (the address is an EEMEM variable address) and return without waiting:
+ * the bytes are written one by one by the EEPROM ready interrupt (about 8.5 ms per byte), a byte which already
+ * has the required value is not written again (no wear). The data is not copied, so it must not change
+ * until the write is complete (see EEPROM_IsBusy() and EEPROM_SetCallBack()).
+ * The function will return FALSE if the previous write is not complete yet.
+ */
+boolean EEPROM_Write(uint8 * address, const uint8 * data, uint8 length)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	if (EECR & (1 << EERIE))
+	{
+		SREG = sreg;
+		return FALSE;
+	}
+	g_writeAddress = address;
+	g_writeData = data;
+	g_writeLength = length;
+	EECR |= (1 << EERIE);
+	SREG = sreg;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * The function will return TRUE while a write started by EEPROM_Write() is not complete.
+ */
+boolean EEPROM_IsBusy(void)
+{
+	return (EECR & (1 << EERIE)) ? TRUE : FALSE;
+}
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the EEPROM ready ISR when the last byte of a write is complete.
+ */
+void EEPROM_SetCallBack(void(*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description:
+ * The function will return the number of bytes really written (erased and programmed) since the reset.
+ */
+uint32 EEPROM_GetWrittenBytes(void)
+{
+	uint8 sreg = SREG;
+	uint32 writtenBytes;
+
+	cli();
+	writtenBytes = g_writtenBytes;
+	SREG = sreg;
+	return writtenBytes;
+}
+
+/*
+ * Description:
+ * The function will return the number of bytes not written since the reset because they already had the value.
+ */
+uint32 EEPROM_GetSkippedBytes(void)
+{
+	uint8 sreg = SREG;
+	uint32 skippedBytes;
+
+	cli();
+	skippedBytes = g_skippedBytes;
+	SREG = sreg;
+	return skippedBytes;
+}
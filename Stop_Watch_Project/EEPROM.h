@@ -0,0 +1,58 @@
+/*******************************************************************************************************************
+ * File Name: EEPROM.h
+ * Date: 16/10/2026
+ * Driver: ATmega32 Internal EEPROM Driver Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Read bytes from the EEPROM (the address is an EEMEM variable address).
+ * The function will return FALSE if a write is in progress (the EEPROM can not be read while it is written).
+ */
+boolean EEPROM_Read(const uint8 * address, uint8 * data, uint8 length);
+
+/*
+ * Description:
+ * Start writing bytes to the EEPROM (the address is an EEMEM variable address) and return without waiting:
+ * the bytes are written one by one by the EEPROM ready interrupt (about 8.5 ms per byte), a byte which already
+ * has the required value is not written again (no wear). The data is not copied, so it must not change
+ * until the write is complete (see EEPROM_IsBusy() and EEPROM_SetCallBack()).
+ * The function will return FALSE if the previous write is not complete yet.
+ */
+boolean EEPROM_Write(uint8 * address, const uint8 * data, uint8 length);
+
+/*
+ * Description:
+ * The function will return TRUE while a write started by EEPROM_Write() is not complete.
+ */
+boolean EEPROM_IsBusy(void);
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the EEPROM ready ISR when the last byte of a write is complete.
+ */
+void EEPROM_SetCallBack(void(*a_ptr)(void));
+
+/*
+ * Description:
+ * The function will return the number of bytes really written (erased and programmed) since the reset.
+ */
+uint32 EEPROM_GetWrittenBytes(void);
+
+/*
+ * Description:
+ * The function will return the number of bytes not written since the reset because they already had the value.
+ */
+uint32 EEPROM_GetSkippedBytes(void);
+
+#endif /* EEPROM_H_ */
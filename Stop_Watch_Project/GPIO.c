@@ -5,6 +5,7 @@
  * Author: Youssef Zaki
  ******************************************************************************************************************/
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include "GPIO.h"
 #include "Common_Macros.h"
 
@@ -306,3 +307,55 @@ uint8 GPIO_ReadPORT(uint8 Port_Num)
 	}
 	return Port_Value;
 }
+
+/*
+ * Description:
+ * write the value on the pins selected by the mask in the required PORT in one read-modify-write,
+ * the other pins of the PORT keep their values: PORT = (PORT & ~mask) | (value & mask)
+ * If the PORT number is not correct, the function will not handle the request
+ * Not safe if an interrupt writes the same PORT, use GPIO_WritePortMasked_Atomic in this case.
+ */
+void GPIO_WritePortMasked(uint8 Port_Num, uint8 mask, uint8 value)
+{
+	/* Keep only the bits to be written, so the OR below can not touch the other pins */
+	value &= mask;
+
+	/* CHECK IF THE CORRECT NUMBER OF PORT IS ENTERED */
+	if ((Port_Num >= PORTA_ID && Port_Num <= PORTD_ID))
+	{
+		switch (Port_Num)
+		{
+		case PORTA_ID:
+			PORTA = (PORTA & ~mask) | value;
+			break;
+		case PORTB_ID:
+			PORTB = (PORTB & ~mask) | value;
+			break;
+		case PORTC_ID:
+			PORTC = (PORTC & ~mask) | value;
+			break;
+		case PORTD_ID:
+			PORTD = (PORTD & ~mask) | value;
+			break;
+		}
+	}
+	else
+	{
+		/* Do nothing if the entered port number is not correct */
+	}
+}
+
+/*
+ * Description:
+ * Same as GPIO_WritePortMasked, but the read-modify-write is done with the interrupts disabled,
+ * so an ISR writing other pins of the same PORT can not be lost. The I-bit is restored after the write.
+ */
+void GPIO_WritePortMasked_Atomic(uint8 Port_Num, uint8 mask, uint8 value)
+{
+	/* Save the I-bit, so the function can also be called with the interrupts already disabled */
+	uint8 sreg = SREG;
+
+	cli();
+	GPIO_WritePortMasked(Port_Num, mask, value);
+	SREG = sreg;
+}
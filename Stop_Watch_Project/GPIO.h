@@ -5,6 +5,7 @@
  * Author: Youssef Zaki
  ******************************************************************************************************************/
 #include "Standard_Types.h"
+#include <avr/io.h>
 
 #ifndef GPIO_H_
 #define GPIO_H_
@@ -94,4 +95,123 @@ void GPIO_WritePORT(uint8 Port_num, uint8 value);
  */
 uint8 GPIO_ReadPORT(uint8 Port_num);
 
+/*
+ * Description:
+ * write the value on the pins selected by the mask in the required PORT in one read-modify-write,
+ * the other pins of the PORT keep their values: PORT = (PORT & ~mask) | (value & mask)
+ * If the PORT number is not correct, the function will not handle the request
+ * Not safe if an interrupt writes the same PORT, use GPIO_WritePortMasked_Atomic in this case.
+ */
+void GPIO_WritePortMasked(uint8 Port_num, uint8 mask, uint8 value);
+
+/*
+ * Description:
+ * Same as GPIO_WritePortMasked, but the read-modify-write is done with the interrupts disabled,
+ * so an ISR writing other pins of the same PORT can not be lost. The I-bit is restored after the write.
+ */
+void GPIO_WritePortMasked_Atomic(uint8 Port_num, uint8 mask, uint8 value);
+
+/****************************************************************************************
+ *                                  Fast (Compile-Time) GPIO API                        *
+ ****************************************************************************************/
+
+/*
+ * The following functions do the same job as the functions above, but the PORT and PIN numbers
+ * MUST be compile-time constants (e.g. PORTC_ID, PIN3_ID). They are always inlined, so the switch
+ * is removed by the compiler and each call becomes a single SBI/CBI (or SBIC/SBIS) instruction.
+ * There is no range check: use the functions above when the PORT or PIN is chosen at run time.
+ */
+#define GPIO_ALWAYS_INLINE static inline __attribute__((always_inline))
+
+/*
+ * Description:
+ * Return the address of the PORTx, DDRx or PINx register of the required PORT.
+ */
+GPIO_ALWAYS_INLINE volatile uint8 * GPIO_PortRegister_Fast(uint8 Port_Num)
+{
+	switch (Port_Num)
+	{
+	case PORTA_ID: return &PORTA;
+	case PORTB_ID: return &PORTB;
+	case PORTC_ID: return &PORTC;
+	default:       return &PORTD;
+	}
+}
+
+GPIO_ALWAYS_INLINE volatile uint8 * GPIO_DirectionRegister_Fast(uint8 Port_Num)
+{
+	switch (Port_Num)
+	{
+	case PORTA_ID: return &DDRA;
+	case PORTB_ID: return &DDRB;
+	case PORTC_ID: return &DDRC;
+	default:       return &DDRD;
+	}
+}
+
+GPIO_ALWAYS_INLINE volatile uint8 * GPIO_PinRegister_Fast(uint8 Port_Num)
+{
+	switch (Port_Num)
+	{
+	case PORTA_ID: return &PINA;
+	case PORTB_ID: return &PINB;
+	case PORTC_ID: return &PINC;
+	default:       return &PIND;
+	}
+}
+
+/*
+ * Description:
+ * Compile-time version of GPIO_SetupPinDirection (Port_Num and Pin_Num must be constants).
+ */
+GPIO_ALWAYS_INLINE void GPIO_SetupPinDirection_Fast(uint8 Port_Num, uint8 Pin_Num, uint8 direction)
+{
+	if (direction == OUTPUT_PIN)
+	{
+		*GPIO_DirectionRegister_Fast(Port_Num) |= (1 << Pin_Num);
+	}
+	else
+	{
+		*GPIO_DirectionRegister_Fast(Port_Num) &= ~(1 << Pin_Num);
+	}
+}
+
+/*
+ * Description:
+ * Compile-time version of GPIO_WritePin (Port_Num and Pin_Num must be constants).
+ */
+GPIO_ALWAYS_INLINE void GPIO_WritePin_Fast(uint8 Port_Num, uint8 Pin_Num, uint8 value)
+{
+	if (value == LOGIC_HIGH)
+	{
+		*GPIO_PortRegister_Fast(Port_Num) |= (1 << Pin_Num);
+	}
+	else
+	{
+		*GPIO_PortRegister_Fast(Port_Num) &= ~(1 << Pin_Num);
+	}
+}
+
+/*
+ * Description:
+ * Compile-time version of GPIO_ReadPin (Port_Num and Pin_Num must be constants).
+ * The function will return LOGIC HIGH or LOGIC LOW
+ */
+GPIO_ALWAYS_INLINE uint8 GPIO_ReadPin_Fast(uint8 Port_Num, uint8 Pin_Num)
+{
+	return ((*GPIO_PinRegister_Fast(Port_Num) & (1 << Pin_Num)) ? LOGIC_HIGH : LOGIC_LOW);
+}
+
+/*
+ * Description:
+ * Compile-time version of GPIO_WritePortMasked (Port_Num must be a constant).
+ * Not safe if an interrupt writes the same PORT.
+ */
+GPIO_ALWAYS_INLINE void GPIO_WritePortMasked_Fast(uint8 Port_Num, uint8 mask, uint8 value)
+{
+	volatile uint8 * port_reg = GPIO_PortRegister_Fast(Port_Num);
+
+	*port_reg = (*port_reg & ~mask) | (value & mask);
+}
+
 #endif /* GPIO_H_ */
@@ -0,0 +1,249 @@
+/*******************************************************************************************************************
+ * File Name: Host_Emulation.c
+ * Date: 16/10/2026
+ * Driver: ATmega32 Register File Emulation Source File (Host Build Only)
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+
+/* The file is part of the Eclipse project folder, so it must compile to nothing for the AVR target */
+#ifndef __AVR__
+
+#include <avr/io.h>
+#include "Host_Emulation.h"
+#include <stddef.h>
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Used in the vector table for vectors which have no enable bit or no interrupt flag */
+#define HOST_NO_REGISTER                           0xFF
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+typedef struct
+{
+	uint8_t enable_reg;   /* I/O address of the register holding the interrupt enable bit */
+	uint8_t enable_bit;
+	uint8_t flag_reg;     /* I/O address of the register holding the interrupt flag */
+	uint8_t flag_bit;
+	uint8_t auto_clear;   /* TRUE if the hardware clears the flag when the vector is executed */
+}Host_VectorInfoType;
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+volatile Host_IOSpaceType Host_IO;
+
+/*
+ * ISRs are weak references: a vector which is not defined by the linked drivers/application
+ * resolves to a NULL address and is never called.
+ */
+void __vector_1(void) __attribute__((weak));
+void __vector_2(void) __attribute__((weak));
+void __vector_3(void) __attribute__((weak));
+void __vector_4(void) __attribute__((weak));
+void __vector_5(void) __attribute__((weak));
+void __vector_6(void) __attribute__((weak));
+void __vector_7(void) __attribute__((weak));
+void __vector_8(void) __attribute__((weak));
+void __vector_9(void) __attribute__((weak));
+void __vector_10(void) __attribute__((weak));
+void __vector_11(void) __attribute__((weak));
+void __vector_12(void) __attribute__((weak));
+void __vector_13(void) __attribute__((weak));
+void __vector_14(void) __attribute__((weak));
+void __vector_15(void) __attribute__((weak));
+void __vector_16(void) __attribute__((weak));
+void __vector_17(void) __attribute__((weak));
+void __vector_18(void) __attribute__((weak));
+void __vector_19(void) __attribute__((weak));
+void __vector_20(void) __attribute__((weak));
+
+static void (* const g_vectorTable[HOST_NUM_OF_VECTORS])(void) =
+{
+	NULL, __vector_1, __vector_2, __vector_3, __vector_4, __vector_5, __vector_6,
+	__vector_7, __vector_8, __vector_9, __vector_10, __vector_11, __vector_12, __vector_13,
+	__vector_14, __vector_15, __vector_16, __vector_17, __vector_18, __vector_19, __vector_20
+};
+
+/* Enable bit and interrupt flag of every vector as described at the ATmega32 data sheet */
+static const Host_VectorInfoType g_vectorInfo[HOST_NUM_OF_VECTORS] =
+{
+	{HOST_NO_REGISTER, 0,      HOST_NO_REGISTER, 0,     0}, /* RESET */
+	{0x3B,             INT0,   0x3A,             INTF0, 1}, /* INT0: GICR, GIFR */
+	{0x3B,             INT1,   0x3A,             INTF1, 1}, /* INT1: GICR, GIFR */
+	{0x3B,             INT2,   0x3A,             INTF2, 1}, /* INT2: GICR, GIFR */
+	{0x39,             OCIE2,  0x38,             OCF2,  1}, /* TIMER2_COMP: TIMSK, TIFR */
+	{0x39,             TOIE2,  0x38,             TOV2,  1}, /* TIMER2_OVF: TIMSK, TIFR */
+	{0x39,             TICIE1, 0x38,             ICF1,  1}, /* TIMER1_CAPT: TIMSK, TIFR */
+	{0x39,             OCIE1A, 0x38,             OCF1A, 1}, /* TIMER1_COMPA: TIMSK, TIFR */
+	{0x39,             OCIE1B, 0x38,             OCF1B, 1}, /* TIMER1_COMPB: TIMSK, TIFR */
+	{0x39,             TOIE1,  0x38,             TOV1,  1}, /* TIMER1_OVF: TIMSK, TIFR */
+	{0x39,             OCIE0,  0x38,             OCF0,  1}, /* TIMER0_COMP: TIMSK, TIFR */
+	{0x39,             TOIE0,  0x38,             TOV0,  1}, /* TIMER0_OVF: TIMSK, TIFR */
+	{0x0D,             7,      0x0E,             7,     1}, /* SPI_STC: SPCR(SPIE), SPSR(SPIF) */
+	{0x0A,             RXCIE,  0x0B,             RXC,   0}, /* USART_RXC: UCSRB, UCSRA (cleared by reading UDR) */
+	{0x0A,             UDRIE,  0x0B,             UDRE,  0}, /* USART_UDRE: UCSRB, UCSRA (cleared by writing UDR) */
+	{0x0A,             TXCIE,  0x0B,             TXC,   1}, /* USART_TXC: UCSRB, UCSRA */
+	{0x06,             3,      0x06,             4,     1}, /* ADC: ADCSRA(ADIE), ADCSRA(ADIF) */
+	{0x1C,             EERIE,  HOST_NO_REGISTER, 0,     0}, /* EE_RDY: EECR (level interrupt, no flag) */
+	{0x08,             3,      0x08,             4,     1}, /* ANA_COMP: ACSR(ACIE), ACSR(ACI) */
+	{0x36,             0,      0x36,             7,     0}, /* TWI: TWCR(TWIE), TWCR(TWINT) */
+	{0x37,             7,      HOST_NO_REGISTER, 0,     0}  /* SPM_RDY: SPMCR(SPMIE) (level interrupt, no flag) */
+};
+
+/*
+ * Requests raised by Host_FireVector() and not executed yet, for the vectors whose flag is cleared by writing one:
+ * the register file is plain memory, so a driver writing one to clear such a flag sets it in the emulation,
+ * and the flag alone can not tell a real request.
+ */
+static volatile uint8_t g_vectorRequest[HOST_NUM_OF_VECTORS];
+
+/* Called by Host_Sleep(), set by the test */
+static void (*g_sleepHook)(void) = NULL;
+
+/* Number of WDR instructions executed */
+static uint32_t g_watchdogResets = 0;
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Execute the ISR of the vector if the I-bit and the vector enable bit are set.
+ * The I-bit is cleared during the ISR and set again at its end (RETI).
+ */
+static uint8_t Host_ExecuteVector(uint8_t vector_num)
+{
+	const Host_VectorInfoType * info = &g_vectorInfo[vector_num];
+
+	if ( !(SREG & (1 << SREG_I)) )
+	{
+		return 0;
+	}
+	if ( (info -> enable_reg != HOST_NO_REGISTER) && !(Host_IO.byte[info -> enable_reg] & (1 << info -> enable_bit)) )
+	{
+		return 0;
+	}
+	if ( (info -> flag_reg != HOST_NO_REGISTER) && (info -> auto_clear) )
+	{
+		Host_IO.byte[info -> flag_reg] &= ~(1 << info -> flag_bit);
+	}
+	g_vectorRequest[vector_num] = 0;
+	if (g_vectorTable[vector_num] != NULL)
+	{
+		SREG &= ~(1 << SREG_I);
+		g_vectorTable[vector_num]();
+		SREG |= (1 << SREG_I);
+	}
+	return 1;
+}
+
+/*
+ * Description:
+ * Clear the whole emulated register file (the same state as after a power-on reset).
+ */
+void Host_Reset(void)
+{
+	uint8_t address;
+
+	for (address = 0; address < HOST_IO_SPACE_SIZE; address++)
+	{
+		Host_IO.byte[address] = 0;
+	}
+	for (address = 0; address < HOST_NUM_OF_VECTORS; address++)
+	{
+		g_vectorRequest[address] = 0;
+	}
+}
+
+/*
+ * Description:
+ * Raise the interrupt request of the required vector (e.g. 7 for TIMER1_COMPA, 1 for INT0).
+ * 1. The interrupt flag of the vector is set (if the vector has one).
+ * 2. If the I-bit in SREG and the vector enable bit are set, the ISR is executed immediately
+ *    with the I-bit cleared during its execution (like the hardware does) and the flag is cleared.
+ * The function will return TRUE if the ISR is executed, otherwise the request stays pending.
+ */
+uint8_t Host_FireVector(uint8_t vector_num)
+{
+	if ( (vector_num == 0) || (vector_num >= HOST_NUM_OF_VECTORS) )
+	{
+		return 0;
+	}
+	if (g_vectorInfo[vector_num].flag_reg != HOST_NO_REGISTER)
+	{
+		Host_IO.byte[g_vectorInfo[vector_num].flag_reg] |= (1 << g_vectorInfo[vector_num].flag_bit);
+	}
+	g_vectorRequest[vector_num] = 1;
+	return Host_ExecuteVector(vector_num);
+}
+
+/*
+ * Description:
+ * Execute all pending and enabled interrupt requests according to the hardware priority
+ * (lower vector number first). Call it after sei() or after enabling a source.
+ * A flag cleared by writing one (GIFR, TIFR ...) is pending only if it was raised by Host_FireVector().
+ */
+void Host_ServicePendingVectors(void)
+{
+	uint8_t vector_num;
+
+	for (vector_num = 1; vector_num < HOST_NUM_OF_VECTORS; vector_num++)
+	{
+		const Host_VectorInfoType * info = &g_vectorInfo[vector_num];
+
+		/* Level interrupts (no flag, or a flag following the hardware state) are pending while their flag is set */
+		if ( (info -> flag_reg == HOST_NO_REGISTER) || ((info -> auto_clear) && g_vectorRequest[vector_num]) ||
+		     (!(info -> auto_clear) && (Host_IO.byte[info -> flag_reg] & (1 << info -> flag_bit))) )
+		{
+			(void)Host_ExecuteVector(vector_num);
+		}
+	}
+}
+
+/*
+ * Description:
+ * Set the function called every time the application puts the CPU to sleep (sleep_cpu()),
+ * a test can fire the next interrupts from it, so the application runs in a single thread.
+ */
+void Host_SetSleepHook(void (*hook)(void))
+{
+	g_sleepHook = hook;
+}
+
+/*
+ * Description:
+ * Emulation of the SLEEP instruction: call the sleep hook (if any), then execute the pending interrupts.
+ */
+void Host_Sleep(void)
+{
+	if (g_sleepHook != NULL)
+	{
+		g_sleepHook();
+	}
+	Host_ServicePendingVectors();
+}
+
+/*
+ * Description:
+ * Emulation of the WDR instruction (wdt_reset()): count the resets of the watchdog timer.
+ */
+void Host_WatchdogReset(void)
+{
+	g_watchdogResets++;
+}
+
+/*
+ * Description:
+ * The function will return the number of watchdog timer resets (WDR instructions) since the start of the test.
+ */
+uint32_t Host_GetWatchdogResets(void)
+{
+	return g_watchdogResets;
+}
+
+#endif /* __AVR__ */
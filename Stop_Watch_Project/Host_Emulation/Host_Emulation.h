@@ -0,0 +1,103 @@
+/*******************************************************************************************************************
+ * File Name: Host_Emulation.h
+ * Date: 16/10/2026
+ * Driver: ATmega32 Register File Emulation Header File (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * This folder lets the same driver sources be compiled on a PC (x86 Linux) instead of the AVR target.
+ * Add this folder to the include path BEFORE the system one, so <avr/io.h>, <avr/interrupt.h> and
+ * <util/delay.h> resolve to the emulated versions, e.g.:
+ *     gcc -IHost_Emulation -DF_CPU=1000000UL GPIO.c INT.c TIMER1.c SevenSegment.c Host_Emulation/Host_Emulation.c ...
+ * The Makefile of the Host_Tests folder builds all the drivers and the application so, and runs the host tests.
+ * The AVR build never includes these headers and Host_Emulation.c is empty when compiled by avr-gcc.
+ ******************************************************************************************************************/
+#include <stdint.h>
+
+#ifndef HOST_EMULATION_H_
+#define HOST_EMULATION_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* ATmega32 I/O space is 64 registers (I/O addresses 0x00 .. 0x3F) */
+#define HOST_IO_SPACE_SIZE                         0x40
+
+/* ATmega32 has 21 vectors including the RESET vector (vector 0) */
+#define HOST_NUM_OF_VECTORS                        21
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/*
+ * The I/O space seen as bytes (8-bit registers) and as words (16-bit registers such as TCNT1, OCR1A and ICR1).
+ * All 16-bit registers of the ATmega32 start at an even I/O address and are little endian like the host.
+ */
+typedef union
+{
+	uint8_t  byte[HOST_IO_SPACE_SIZE];
+	uint16_t word[HOST_IO_SPACE_SIZE / 2];
+}Host_IOSpaceType;
+
+/****************************************************************************************
+ *                                      Global Variables                                *
+ ****************************************************************************************/
+
+/* The emulated register file, accessed by the register macros in <avr/io.h> */
+extern volatile Host_IOSpaceType Host_IO;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Clear the whole emulated register file (the same state as after a power-on reset).
+ */
+void Host_Reset(void);
+
+/*
+ * Description:
+ * Raise the interrupt request of the required vector (e.g. 7 for TIMER1_COMPA, 1 for INT0).
+ * 1. The interrupt flag of the vector is set (if the vector has one).
+ * 2. If the I-bit in SREG and the vector enable bit are set, the ISR is executed immediately
+ *    with the I-bit cleared during its execution (like the hardware does) and the flag is cleared.
+ * The function will return TRUE if the ISR is executed, otherwise the request stays pending.
+ */
+uint8_t Host_FireVector(uint8_t vector_num);
+
+/*
+ * Description:
+ * Execute all pending and enabled interrupt requests according to the hardware priority
+ * (lower vector number first). Call it after sei() or after enabling a source.
+ * A flag cleared by writing one (GIFR, TIFR ...) is pending only if it was raised by Host_FireVector().
+ */
+void Host_ServicePendingVectors(void);
+
+/*
+ * Description:
+ * Set the function called every time the application puts the CPU to sleep (sleep_cpu()),
+ * a test can fire the next interrupts from it, so the application runs in a single thread.
+ */
+void Host_SetSleepHook(void (*hook)(void));
+
+/*
+ * Description:
+ * Emulation of the SLEEP instruction: call the sleep hook (if any), then execute the pending interrupts.
+ */
+void Host_Sleep(void);
+
+/*
+ * Description:
+ * Emulation of the WDR instruction (wdt_reset()): count the resets of the watchdog timer.
+ */
+void Host_WatchdogReset(void);
+
+/*
+ * Description:
+ * The function will return the number of watchdog timer resets (WDR instructions) since the start of the test.
+ */
+uint32_t Host_GetWatchdogResets(void);
+
+#endif /* HOST_EMULATION_H_ */
@@ -0,0 +1,31 @@
+/*******************************************************************************************************************
+ * File Name: eeprom.h
+ * Date: 16/10/2026
+ * Driver: EEPROM Access Functions (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The host has one address space, so EEMEM data is normal data (kept across Host_Reset(), like the EEPROM
+ * keeps it across a power cycle) and the EEPROM is read and written directly, the writes complete immediately.
+ * All the EEMEM data is placed in the "host_eeprom" section, so a test can save, load or erase the whole
+ * emulated EEPROM between two runs through the linker symbols __start_host_eeprom and __stop_host_eeprom.
+ ******************************************************************************************************************/
+#ifndef HOST_AVR_EEPROM_H_
+#define HOST_AVR_EEPROM_H_
+
+#include <stdint.h>
+
+#define EEMEM                                      __attribute__((section("host_eeprom")))
+
+static inline uint8_t eeprom_read_byte(const uint8_t * address)
+{
+	return *(const volatile uint8_t *)address;
+}
+
+static inline void eeprom_write_byte(uint8_t * address, uint8_t value)
+{
+	*(volatile uint8_t *)address = value;
+}
+
+#define eeprom_is_ready()                          (1)
+
+#endif /* HOST_AVR_EEPROM_H_ */
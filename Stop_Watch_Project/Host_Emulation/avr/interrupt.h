@@ -0,0 +1,29 @@
+/*******************************************************************************************************************
+ * File Name: interrupt.h
+ * Date: 16/10/2026
+ * Driver: Interrupt Macros over the Emulated Register File (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * ISR(vector) defines a normal C function named after the vector (e.g. __vector_7 for TIMER1_COMPA_vect),
+ * so Host_FireVector() can call it. sei() and cli() only change the I-bit of the emulated SREG.
+ ******************************************************************************************************************/
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+/* Attributes of the avr-libc ISR macro (ISR_BLOCK, ISR_NOBLOCK, ...) have no meaning on the host */
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define ISR_ALIASOF(vector)
+
+#define ISR(vector, ...)                           void vector(void); void vector(void)
+#define EMPTY_INTERRUPT(vector)                    void vector(void); void vector(void) {}
+
+/* Global interrupt enable/disable (I-bit in SREG) */
+#define sei()                                      (SREG |= (1 << SREG_I))
+#define cli()                                      (SREG &= ~(1 << SREG_I))
+#define reti()
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,21 @@
+/*******************************************************************************************************************
+ * File Name: pgmspace.h
+ * Date: 16/10/2026
+ * Driver: Program Memory Access Macros (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The host has one address space, so PROGMEM data is normal constant data and is read directly.
+ ******************************************************************************************************************/
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+#define PSTR(s)                                    (s)
+
+#define pgm_read_byte(address)                     (*(const uint8_t *)(address))
+#define pgm_read_word(address)                     (*(const uint16_t *)(address))
+#define pgm_read_dword(address)                    (*(const uint32_t *)(address))
+
+#endif /* HOST_AVR_PGMSPACE_H_ */
@@ -0,0 +1,30 @@
+/*******************************************************************************************************************
+ * File Name: sleep.h
+ * Date: 16/10/2026
+ * Driver: Sleep Mode Macros over the Emulated Register File (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The sleep mode and sleep enable bits are kept in the emulated MCUCR, sleep_cpu() calls Host_Sleep()
+ * which gives the control to the test (sleep hook) to fire the interrupts which wake the CPU up.
+ ******************************************************************************************************************/
+#ifndef HOST_AVR_SLEEP_H_
+#define HOST_AVR_SLEEP_H_
+
+#include <avr/io.h>
+#include "../Host_Emulation.h"
+
+/* SM2:0 bits in MCUCR as described at the ATmega32 data sheet */
+#define SLEEP_MODE_IDLE                            0
+#define SLEEP_MODE_ADC                             (1 << SM0)
+#define SLEEP_MODE_PWR_DOWN                        (1 << SM1)
+#define SLEEP_MODE_PWR_SAVE                        ((1 << SM0) | (1 << SM1))
+#define SLEEP_MODE_STANDBY                         ((1 << SM1) | (1 << SM2))
+#define SLEEP_MODE_EXT_STANDBY                     ((1 << SM0) | (1 << SM1) | (1 << SM2))
+
+#define set_sleep_mode(mode)                       (MCUCR = (MCUCR & ~((1 << SM0) | (1 << SM1) | (1 << SM2))) | (mode))
+#define sleep_enable()                             (MCUCR |= (1 << SE))
+#define sleep_disable()                            (MCUCR &= ~(1 << SE))
+#define sleep_cpu()                                Host_Sleep()
+#define sleep_mode()                               do { sleep_enable(); sleep_cpu(); sleep_disable(); } while (0)
+
+#endif /* HOST_AVR_SLEEP_H_ */
@@ -0,0 +1,30 @@
+/*******************************************************************************************************************
+ * File Name: wdt.h
+ * Date: 16/10/2026
+ * Driver: Watchdog Timer Macros over the Emulated Register File (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The watchdog enable and pre-scaler bits are kept in the emulated WDTCR (the timed WDTOE sequence is not needed),
+ * wdt_reset() calls Host_WatchdogReset(), so a test can count the resets of the watchdog and see when they stop.
+ ******************************************************************************************************************/
+#ifndef HOST_AVR_WDT_H_
+#define HOST_AVR_WDT_H_
+
+#include <avr/io.h>
+#include "../Host_Emulation.h"
+
+/* WDP2:0 bits in WDTCR as described at the ATmega32 data sheet (typical timeouts at VCC = 5V) */
+#define WDTO_15MS                                  0
+#define WDTO_30MS                                  1
+#define WDTO_60MS                                  2
+#define WDTO_120MS                                 3
+#define WDTO_250MS                                 4
+#define WDTO_500MS                                 5
+#define WDTO_1S                                    6
+#define WDTO_2S                                    7
+
+#define wdt_enable(timeout)                        (WDTCR = (1 << WDE) | ((timeout) & 0x07))
+#define wdt_disable()                              (WDTCR = 0)
+#define wdt_reset()                                Host_WatchdogReset()
+
+#endif /* HOST_AVR_WDT_H_ */
@@ -0,0 +1,26 @@
+/*******************************************************************************************************************
+ * File Name: delay.h
+ * Date: 16/10/2026
+ * Driver: Busy-Wait Delays (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The host does not execute the AVR instructions, so the busy-wait delays return immediately.
+ ******************************************************************************************************************/
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+#ifndef F_CPU
+#define F_CPU 1000000UL
+#endif
+
+static inline void _delay_ms(double ms)
+{
+	(void)ms;
+}
+
+static inline void _delay_us(double us)
+{
+	(void)us;
+}
+
+#endif /* HOST_UTIL_DELAY_H_ */
@@ -0,0 +1,49 @@
+/*******************************************************************************************************************
+ * File Name: Bench_StopWatchTick.c
+ * Date: 16/10/2026
+ * Driver: Host Benchmark of StopWatch_Tick() with STOPWATCH_NUM_OF_CHANNELS Channels Running (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built by the Makefile for 1, 4 and 8 channels, all of them running. StopWatch_Tick() is called for 50 million
+ * ticks and the time per tick on this PC is printed, to compare two versions of the driver on the same PC
+ * (the AVR cycles are measured by the simavr benchmark).
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include <stdio.h>
+#include <time.h>
+#include "Standard_Types.h"
+#include "SevenSegment.h"
+#include "StopWatch.h"
+
+#define BENCH_TICKS                    50000000UL
+
+int main(void)
+{
+	struct timespec start;
+	struct timespec end;
+	StopWatch_ChannelType channel;
+	uint32 tick;
+	double ns;
+
+	SevenSegment_Multiplex_Init();
+	StopWatch_Init(StopWatch_HH_MM_SS);
+	for (channel = 1; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		StopWatch_Start(channel);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (tick = 0; tick < BENCH_TICKS; tick++)
+	{
+		StopWatch_Tick();
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	ns = ((double)(end.tv_sec - start.tv_sec) * 1e9) + (double)(end.tv_nsec - start.tv_nsec);
+	printf("Bench_StopWatchTick: %u channels: %.2f ns per tick\n", (unsigned)STOPWATCH_NUM_OF_CHANNELS,
+	       ns / BENCH_TICKS);
+	return 0;
+}
+
+#endif /* __AVR__ */
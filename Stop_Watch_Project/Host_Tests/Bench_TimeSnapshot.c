@@ -0,0 +1,83 @@
+/*******************************************************************************************************************
+ * File Name: Bench_TimeSnapshot.c
+ * Date: 16/10/2026
+ * Driver: Host Benchmark of StopWatch_GetTime() Against a Copy with the Interrupts Disabled (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The driver is included (the Makefile leaves StopWatch.c out of the link), so the same digits can be copied
+ * in a cli() / SREG critical section for the comparison. Both copies are timed for 50 million reads without
+ * any tick (the retry of the snapshot is not taken). On the AVR cli/SREG costs two cycles, on this PC they are
+ * plain memory accesses of the emulated SREG: compare two versions here, the AVR cycles come from simavr.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include <stdio.h>
+#include <time.h>
+#include "../StopWatch.c"
+
+#define BENCH_READS                    50000000UL
+
+/* The reference: the same copy and conversion as StopWatch_GetTime() with the interrupts disabled */
+static void __attribute__((noinline)) Bench_GetTimeCritical(StopWatch_ChannelType channel, StopWatch_TimeType * time)
+{
+	uint8 digits[STOPWATCH_NUM_OF_DIGITS];
+	uint8 sreg = SREG;
+	uint8 digit;
+
+	cli();
+	for (digit = 0; digit < STOPWATCH_NUM_OF_DIGITS; digit++)
+	{
+		digits[digit] = g_timeDigits[channel][digit];
+	}
+	SREG = sreg;
+
+	time -> hours = (digits[STOPWATCH_HOURS_TENS] * 10) + digits[STOPWATCH_HOURS_UNITS];
+	time -> minutes = (digits[STOPWATCH_MINUTES_TENS] * 10) + digits[STOPWATCH_MINUTES_UNITS];
+	time -> seconds = (digits[STOPWATCH_SECONDS_TENS] * 10) + digits[STOPWATCH_SECONDS_UNITS];
+	time -> milliseconds = ((uint16)digits[STOPWATCH_MILLISECONDS_HUNDREDS] * 100) +
+	                       (digits[STOPWATCH_MILLISECONDS_TENS] * 10) + digits[STOPWATCH_MILLISECONDS_UNITS];
+}
+
+static double Bench_Elapsed(const struct timespec * start, const struct timespec * end)
+{
+	return ((double)(end -> tv_sec - start -> tv_sec) * 1e9) + (double)(end -> tv_nsec - start -> tv_nsec);
+}
+
+int main(void)
+{
+	StopWatch_TimeType time;
+	struct timespec start;
+	struct timespec end;
+	volatile uint32 sum = 0;
+	uint32 read;
+	double snapshotNs;
+	double criticalNs;
+
+	SevenSegment_Multiplex_Init();
+	StopWatch_Init(StopWatch_HH_MM_SS);
+	SREG |= (1 << SREG_I);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (read = 0; read < BENCH_READS; read++)
+	{
+		StopWatch_GetTime(0, &time);
+		sum += time.milliseconds;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	snapshotNs = Bench_Elapsed(&start, &end) / BENCH_READS;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (read = 0; read < BENCH_READS; read++)
+	{
+		Bench_GetTimeCritical(0, &time);
+		sum += time.milliseconds;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	criticalNs = Bench_Elapsed(&start, &end) / BENCH_READS;
+
+	printf("Bench_TimeSnapshot: StopWatch_GetTime() %.2f ns, cli/SREG copy %.2f ns per read\n",
+	       snapshotNs, criticalNs);
+	return 0;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,65 @@
+/*******************************************************************************************************************
+ * File Name: Bench_TimingWheel.c
+ * Date: 16/10/2026
+ * Driver: Host Benchmark of the Timer1 Tick ISR with BENCH_TIMERS Software Timers Running (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built by the Makefile for 1, 16 and 64 periodic software timers (periods spread from 500 to 4500 ticks).
+ * The compare match ISR is called directly for 20 million ticks, the time per tick on this PC is printed:
+ * with the timing wheel it must not grow with the number of timers (only the cycles of the AVR count,
+ * see the simavr benchmark, this is to compare two versions of the driver on the same PC).
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include <stdio.h>
+#include <time.h>
+#include "Standard_Types.h"
+#include "TIMER1.h"
+
+#ifndef BENCH_TIMERS
+#define BENCH_TIMERS                   1
+#endif
+
+#define BENCH_TICKS                    20000000UL
+
+#if (BENCH_TIMERS > TIMER1_NUM_OF_SOFT_TIMERS)
+#error "Build with TIMER1_NUM_OF_SOFT_TIMERS >= BENCH_TIMERS"
+#endif
+
+/* The tick ISR (TIMER1_COMPA_vect) is called like a function */
+void __vector_7(void);
+
+static volatile uint32 g_callBacks = 0;
+
+static void Bench_CallBack(void)
+{
+	g_callBacks++;
+}
+
+int main(void)
+{
+	struct timespec start;
+	struct timespec end;
+	uint32 timer;
+	uint32 tick;
+	double ns;
+
+	for (timer = 0; timer < BENCH_TIMERS; timer++)
+	{
+		Timer1_SoftTimer_Start((uint16)(500 + ((timer * 37) % 4000)), Timer1_Periodic, Bench_CallBack);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (tick = 0; tick < BENCH_TICKS; tick++)
+	{
+		__vector_7();
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	ns = ((double)(end.tv_sec - start.tv_sec) * 1e9) + (double)(end.tv_nsec - start.tv_nsec);
+	printf("Bench_TimingWheel: %2u timers: %.1f ns per tick (%lu call backs)\n", (unsigned)BENCH_TIMERS,
+	       ns / BENCH_TICKS, (unsigned long)g_callBacks);
+	return 0;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,224 @@
+/*******************************************************************************************************************
+ * File Name: Host_Test.c
+ * Date: 16/10/2026
+ * Driver: Host Tests Common Functions Source File (Host Build Only)
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+
+/* The file is part of the Eclipse project folder, so it must compile to nothing for the AVR target */
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include "Telemetry.h"
+#include <avr/io.h>
+#include <stdio.h>
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+static uint32 g_checks = 0;
+static uint32 g_failures = 0;
+
+/* Bytes sent by the UART and the next one to be decoded */
+static uint8 g_uartTx[HOST_TEST_UART_BUFFER_SIZE];
+static uint32 g_uartTxCount = 0;
+static uint32 g_uartTxRead = 0;
+static uint32 g_uartBadBytes = 0;
+
+/* Characters waiting to be received by the UART */
+static char g_uartRx[256];
+static uint8 g_uartRxHead = 0;
+static uint8 g_uartRxTail = 0;
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Count the check and print it if it failed (use HOST_TEST_CHECK()).
+ */
+void Host_Test_Check(boolean condition, const char * text, const char * file, int line)
+{
+	g_checks++;
+	if (condition == FALSE)
+	{
+		g_failures++;
+		printf("%s:%d: check failed: %s\n", file, line, text);
+	}
+}
+
+/*
+ * Description:
+ * Print the result of the test, the function will return the exit status of the test program (0 = passed).
+ */
+int Host_Test_Result(const char * name)
+{
+	if (g_failures == 0)
+	{
+		printf("%s: PASS (%lu checks)\n", name, (unsigned long)g_checks);
+		return 0;
+	}
+	printf("%s: FAIL (%lu of %lu checks)\n", name, (unsigned long)g_failures, (unsigned long)g_checks);
+	return 1;
+}
+
+/*
+ * Description:
+ * One Timer1 tick (one millisecond): the compare match comes with TCNT1 back at 0, as in the CTC mode.
+ */
+void Host_Test_Tick(void)
+{
+	TCNT1 = 0;
+	Host_FireVector(TIMER1_COMPA_vect_num);
+}
+
+/*
+ * Description:
+ * Fire the required number of Timer1 ticks.
+ */
+void Host_Test_Ticks(uint32 ticks)
+{
+	while (ticks--)
+	{
+		Host_Test_Tick();
+	}
+}
+
+/*
+ * Description:
+ * Read the six 7-segments by firing six Timer0 slots: digits[0] is the left digit, a blank digit is ' ',
+ * digits[6] is the string end.
+ */
+void Host_Test_ReadDisplay(char * digits)
+{
+	uint8 slot;
+	uint8 digit;
+	uint8 select;
+
+	for (slot = 0; slot < 6; slot++)
+	{
+		digits[slot] = '?';
+	}
+	for (slot = 0; slot < 6; slot++)
+	{
+		Host_FireVector(TIMER0_COMP_vect_num);
+		select = PORTA & 0x3F;
+		for (digit = 0; digit < 6; digit++)
+		{
+			if (select == (1 << digit))
+			{
+				/* The enable line 0 is the right digit */
+				digits[5 - digit] = ((PORTC & 0x0F) == 0x0F) ? ' ' : (char)('0' + (PORTC & 0x0F));
+			}
+		}
+	}
+	digits[6] = '\0';
+}
+
+/*
+ * Description:
+ * Emulate the UART transmitter for one byte time: if the data register empty interrupt is enabled it is executed,
+ * the byte written to UDR is kept. The function will return TRUE if a byte was sent.
+ */
+boolean Host_Test_UartTransmit(void)
+{
+	if (!(UCSRB & (1 << UDRIE)))
+	{
+		return FALSE;
+	}
+
+	/* The ISR writes the next byte, or disables its interrupt when the buffer is empty */
+	Host_FireVector(USART_UDRE_vect_num);
+	UCSRA &= ~(1 << UDRE);
+	if (!(UCSRB & (1 << UDRIE)))
+	{
+		return FALSE;
+	}
+
+	if (g_uartTxCount < HOST_TEST_UART_BUFFER_SIZE)
+	{
+		g_uartTx[g_uartTxCount++] = UDR;
+	}
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Queue the characters to be received by the UART, one every Host_Test_UartReceive().
+ */
+void Host_Test_UartType(const char * text)
+{
+	while (*text != '\0')
+	{
+		g_uartRx[g_uartRxTail++] = *text++;
+	}
+}
+
+/*
+ * Description:
+ * Emulate the UART receiver for one byte time: the next queued character (if any) comes with the receive interrupt.
+ */
+void Host_Test_UartReceive(void)
+{
+	if (g_uartRxHead != g_uartRxTail)
+	{
+		UDR = (uint8)g_uartRx[g_uartRxHead++];
+		Host_FireVector(USART_RXC_vect_num);
+		UCSRA &= ~(1 << RXC);
+	}
+}
+
+/*
+ * Description:
+ * Decode the next telemetry record from the bytes sent by the UART, the bytes which are not part of a valid record
+ * are skipped and counted. The function will return FALSE if there is no complete record.
+ */
+boolean Host_Test_ReadRecord(Host_Test_RecordType * record)
+{
+	const uint8 * bytes;
+	uint8 checksum;
+	uint8 index;
+
+	while ((g_uartTxRead + TELEMETRY_RECORD_SIZE) <= g_uartTxCount)
+	{
+		bytes = &g_uartTx[g_uartTxRead];
+		checksum = 0;
+		for (index = 1; index < (TELEMETRY_RECORD_SIZE - 1); index++)
+		{
+			checksum ^= bytes[index];
+		}
+
+		if ((bytes[0] != TELEMETRY_SYNC) || (checksum != bytes[TELEMETRY_RECORD_SIZE - 1]))
+		{
+			g_uartTxRead++;
+			g_uartBadBytes++;
+			continue;
+		}
+
+		record -> type = bytes[1];
+		record -> channel = bytes[2];
+		record -> argument = bytes[3];
+		record -> value = (uint32)bytes[4] | ((uint32)bytes[5] << 8) | ((uint32)bytes[6] << 16) | ((uint32)bytes[7] << 24);
+		g_uartTxRead += TELEMETRY_RECORD_SIZE;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+/*
+ * Description:
+ * The function will return the number of bytes sent by the UART and the bytes skipped by Host_Test_ReadRecord().
+ */
+uint32 Host_Test_GetUartBytes(void)
+{
+	return g_uartTxCount;
+}
+
+uint32 Host_Test_GetBadBytes(void)
+{
+	return g_uartBadBytes;
+}
+
+#endif /* __AVR__ */
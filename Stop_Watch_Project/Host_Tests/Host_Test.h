@@ -0,0 +1,110 @@
+/*******************************************************************************************************************
+ * File Name: Host_Test.h
+ * Date: 16/10/2026
+ * Driver: Host Tests Common Functions Header File (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Every test of this folder is a program built by its Makefile from the test file, this file, the drivers and
+ * Host_Emulation.c, it returns 0 if all its checks passed. The tests of the whole application call its main()
+ * as Host_ApplicationMain() (renamed by the Makefile) and drive it from the sleep hook of Host_Emulation:
+ * every time the application sleeps the test fires the next interrupts (one Timer1 tick is one millisecond).
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Check a condition, a failed check is printed with its line and makes the test fail at its end */
+#define HOST_TEST_CHECK(condition)                 Host_Test_Check((condition) ? TRUE : FALSE, #condition, __FILE__, __LINE__)
+
+/* Size of the buffer which keeps the bytes sent by the UART (Host_Test_UartTransmit()) */
+#define HOST_TEST_UART_BUFFER_SIZE                 200000UL
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/* A telemetry record decoded from the bytes sent by the UART (see Telemetry.h) */
+typedef struct {
+uint8 type;
+uint8 channel;
+uint8 argument;
+uint32 value;
+} Host_Test_RecordType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/* main() of StopWatchApplication.c */
+int Host_ApplicationMain(void);
+
+/*
+ * Description:
+ * Count the check and print it if it failed (use HOST_TEST_CHECK()).
+ */
+void Host_Test_Check(boolean condition, const char * text, const char * file, int line);
+
+/*
+ * Description:
+ * Print the result of the test, the function will return the exit status of the test program (0 = passed).
+ */
+int Host_Test_Result(const char * name);
+
+/*
+ * Description:
+ * One Timer1 tick (one millisecond): the compare match comes with TCNT1 back at 0, as in the CTC mode.
+ */
+void Host_Test_Tick(void);
+
+/*
+ * Description:
+ * Fire the required number of Timer1 ticks.
+ */
+void Host_Test_Ticks(uint32 ticks);
+
+/*
+ * Description:
+ * Read the six 7-segments by firing six Timer0 slots: digits[0] is the left digit, a blank digit is ' ',
+ * digits[6] is the string end.
+ */
+void Host_Test_ReadDisplay(char * digits);
+
+/*
+ * Description:
+ * Emulate the UART transmitter for one byte time: if the data register empty interrupt is enabled it is executed,
+ * the byte written to UDR is kept. The function will return TRUE if a byte was sent.
+ */
+boolean Host_Test_UartTransmit(void);
+
+/*
+ * Description:
+ * Queue the characters to be received by the UART, one every Host_Test_UartReceive().
+ */
+void Host_Test_UartType(const char * text);
+
+/*
+ * Description:
+ * Emulate the UART receiver for one byte time: the next queued character (if any) comes with the receive interrupt.
+ */
+void Host_Test_UartReceive(void);
+
+/*
+ * Description:
+ * Decode the next telemetry record from the bytes sent by the UART, the bytes which are not part of a valid record
+ * are skipped and counted. The function will return FALSE if there is no complete record.
+ */
+boolean Host_Test_ReadRecord(Host_Test_RecordType * record);
+
+/*
+ * Description:
+ * The function will return the number of bytes sent by the UART and the bytes skipped by Host_Test_ReadRecord().
+ */
+uint32 Host_Test_GetUartBytes(void);
+uint32 Host_Test_GetBadBytes(void);
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,67 @@
+/*******************************************************************************************************************
+ * File Name: Test_Application.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Whole Stop-Watch Application (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The application counts the Timer1 ticks and shows the time on the display, the pause button stops it.
+ * Built for several F_CPU: the Timer0 display slot is 2 ms with the pre-scaler selected for every clock.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdlib.h>
+#include <string.h>
+#include "StopWatch.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME                      "Test_Application"
+#endif
+
+static uint32 g_ms = 0;
+
+/* Length of the Timer0 CTC period in microseconds, from the running configuration (TCCR0 and OCR0) */
+static uint32 Test_DisplaySlotUs(void)
+{
+	static const uint16 prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+
+	return (uint32)(((uint64)(OCR0 + 1U) * prescalers[TCCR0 & 0x07] * 1000000ULL) / F_CPU);
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	char digits[7];
+
+	Host_Test_Tick();
+	g_ms++;
+
+	switch (g_ms)
+	{
+	case 3000:
+		Host_Test_ReadDisplay(digits);
+		HOST_TEST_CHECK(strcmp(digits, "000003") == 0);
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == TRUE);
+		/* Within 1% of the 2 ms slot (F_CPU is not always a multiple of the pre-scaler times 500 Hz) */
+		HOST_TEST_CHECK((Test_DisplaySlotUs() >= 1980) && (Test_DisplaySlotUs() <= 2020));
+		Host_FireVector(INT1_vect_num);
+		break;
+	case 5000:
+		Host_Test_ReadDisplay(digits);
+		HOST_TEST_CHECK(strcmp(digits, "000003") == 0);
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == FALSE);
+		exit(Host_Test_Result(TEST_NAME));
+		break;
+	}
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,198 @@
+/*******************************************************************************************************************
+ * File Name: Test_Brightness.c
+ * Date: 17/10/2026
+ * Driver: Host Test of the Display Brightness (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The test fires the Timer0 compare matches itself: after every one the display is lit (a digit is selected) or
+ * blank, and the part which starts lasts OCR0 + 1 counts (CTC mode). Every step sends a "bright <level>" command
+ * while the lit part of a slot is running, so the level changes in the middle of the slot: that slot and the next
+ * ones must last exactly one slot, the lit part of the next ones must be level/16 of the slot (level 16: no blank
+ * part) and grow with the level. The levels out of 1 .. 16 are rejected and change nothing.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdlib.h>
+#include "Command.h"
+#include "Telemetry.h"
+
+#define TEST_STEP_MS                   30
+#define TEST_NUM_OF_STEPS              (sizeof(g_steps) / sizeof(g_steps[0]))
+
+/* The 2 ms display slot at 1 MHz with the pre-scaler 8, and the shortest part of a slot (DISPLAY_MIN_PART_COUNTS) */
+#define TEST_SLOT_COUNTS               250U
+#define TEST_MIN_PART_COUNTS           8U
+#define TEST_LEVELS                    16U
+
+#define TEST_SLOTS_PER_STEP            3
+
+typedef struct {
+const char * line;
+uint8 level;
+} Test_StepType;
+
+/* Level 0: the command is rejected, the level of the step before is kept */
+static const Test_StepType g_steps[] =
+{
+	{"bright 1\n",   1},  {"bright 2\n",   2},  {"bright 3\n",   3},  {"bright 4\n",   4},
+	{"bright 5\n",   5},  {"bright 6\n",   6},  {"bright 7\n",   7},  {"bright 8\n",   8},
+	{"bright 9\n",   9},  {"bright 10\n", 10},  {"bright 11\n", 11},  {"bright 12\n", 12},
+	{"bright 13\n", 13},  {"bright 14\n", 14},  {"bright 15\n", 15},  {"bright 16\n", 16},
+	{"bright 5\n",   5},  {"bright 0\n",   0},  {"bright 17\n",  0},  {"bright 255\n", 0},
+	{"bright 1\n",   1},  {"bright 16\n", 16}
+};
+
+static uint32 g_ms = 0;
+static uint8 g_step = 0;
+static uint8 g_level = TEST_LEVELS;
+
+/* Lit part running when the command came, and the lit part of every level */
+static uint16 g_litCounts;
+static uint16 g_levelLitCounts[TEST_LEVELS + 1];
+
+/* One compare match: the function will return the length of the part which starts */
+static uint16 Test_FirePart(boolean * lit)
+{
+	Host_FireVector(TIMER0_COMP_vect_num);
+	*lit = ((PORTA & 0x3F) != 0) ? TRUE : FALSE;
+	return OCR0 + 1U;
+}
+
+/* Fire the compare matches up to the start of a lit part, the function will return its length */
+static uint16 Test_StartSlot(void)
+{
+	boolean lit = FALSE;
+	uint16 counts = 0;
+	uint8 parts;
+
+	for (parts = 0; (parts < 3) && (lit == FALSE); parts++)
+	{
+		counts = Test_FirePart(&lit);
+	}
+	HOST_TEST_CHECK(lit == TRUE);
+	return counts;
+}
+
+/*
+ * The rest of the slot whose lit part is running: the function will return the length of the slot,
+ * the lit part of the next slot is running at the end.
+ */
+static uint16 Test_EndSlot(uint16 litCounts, uint16 * nextLitCounts)
+{
+	boolean lit;
+	uint16 counts = Test_FirePart(&lit);
+	uint16 slot = litCounts;
+
+	if (lit == FALSE)
+	{
+		slot += counts;
+		counts = Test_FirePart(&lit);
+		HOST_TEST_CHECK(lit == TRUE);
+	}
+	*nextLitCounts = counts;
+	return slot;
+}
+
+/* The acknowledgement of the command of the step */
+static void Test_CheckAck(void)
+{
+	Host_Test_RecordType record;
+	uint8 acks = 0;
+	uint8 ack = 0;
+
+	while (Host_Test_ReadRecord(&record) == TRUE)
+	{
+		if (record.type == TELEMETRY_COMMAND_RECORD)
+		{
+			acks++;
+			ack = record.argument;
+		}
+	}
+	HOST_TEST_CHECK(acks == 1);
+	HOST_TEST_CHECK(ack == ((g_steps[g_step].level == 0) ? TELEMETRY_COMMAND_ERROR : Command_Bright));
+}
+
+/* The slot changed in its middle, then the slots of the new level */
+static void Test_CheckSlots(void)
+{
+	uint16 lit;
+	uint16 slot;
+	uint8 slots;
+
+	if (g_steps[g_step].level != 0)
+	{
+		g_level = g_steps[g_step].level;
+	}
+
+	slot = Test_EndSlot(g_litCounts, &lit);
+	HOST_TEST_CHECK(slot == TEST_SLOT_COUNTS);
+	for (slots = 0; slots < TEST_SLOTS_PER_STEP; slots++)
+	{
+		slot = Test_EndSlot(lit, &g_litCounts);
+		HOST_TEST_CHECK(slot == TEST_SLOT_COUNTS);
+		HOST_TEST_CHECK((lit + TEST_MIN_PART_COUNTS) >= ((TEST_SLOT_COUNTS * g_level) / TEST_LEVELS));
+		HOST_TEST_CHECK(lit <= (((TEST_SLOT_COUNTS * g_level) / TEST_LEVELS) + TEST_MIN_PART_COUNTS));
+		if (g_levelLitCounts[g_level] != 0)
+		{
+			HOST_TEST_CHECK(lit == g_levelLitCounts[g_level]);
+		}
+		g_levelLitCounts[g_level] = lit;
+		lit = g_litCounts;
+	}
+
+	HOST_TEST_CHECK((g_level == 1) || (g_levelLitCounts[g_level] > g_levelLitCounts[g_level - 1]));
+	HOST_TEST_CHECK((g_level != TEST_LEVELS) || (g_levelLitCounts[g_level] == TEST_SLOT_COUNTS));
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	Host_Test_RecordType record;
+
+	Host_Test_Tick();
+	g_ms++;
+
+	if ((g_ms % TEST_STEP_MS) == 0)
+	{
+		if (g_ms > TEST_STEP_MS)
+		{
+			/* End of the previous step */
+			Test_CheckAck();
+			Test_CheckSlots();
+			g_step++;
+			if (g_step == TEST_NUM_OF_STEPS)
+			{
+				exit(Host_Test_Result("Test_Brightness"));
+			}
+		}
+		else
+		{
+			/* The records sent at the boot, and the lit part of the full brightness */
+			while (Host_Test_ReadRecord(&record) == TRUE)
+			{
+			}
+			g_litCounts = Test_StartSlot();
+			HOST_TEST_CHECK(g_litCounts == TEST_SLOT_COUNTS);
+		}
+
+		/* The level changes while the lit part of the slot is running (the test does not fire Timer0 meanwhile) */
+		Host_Test_UartType(g_steps[g_step].line);
+	}
+
+	Host_Test_UartReceive();
+	while (Host_Test_UartTransmit() == TRUE)
+	{
+	}
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
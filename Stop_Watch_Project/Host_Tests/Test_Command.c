@@ -0,0 +1,238 @@
+/*******************************************************************************************************************
+ * File Name: Test_Command.c
+ * Date: 17/10/2026
+ * Driver: Host Test of the UART Commands (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Every step types one line to the application, one character every millisecond (9600 baud is about one byte
+ * per millisecond), and checks after TEST_STEP_MS the acknowledgement (the command, or TELEMETRY_COMMAND_ERROR)
+ * and what the command did. Then a line longer than the receive buffer: at this pace it is parsed while it comes
+ * and rejected, the next command works. Last a burst faster than main() (the whole text received in one
+ * millisecond) fills the receive buffer and drops its end of line: the damaged line is rejected at the next end
+ * of line and the command channel works again after it, also when the part of the line received is a valid command.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Command.h"
+#include "StopWatch.h"
+#include "Telemetry.h"
+#include "TIMER1.h"
+#include "UART.h"
+
+#define TEST_STEP_MS                   100
+#define TEST_NUM_OF_STEPS              (sizeof(g_steps) / sizeof(g_steps[0]))
+
+/* No acknowledgement expected at the end of the step */
+#define TEST_NO_ACK                    0xFE
+
+typedef struct {
+const char * line;
+uint8 ack;
+boolean burst;
+} Test_StepType;
+
+/* A line of 40 characters with no name: longer than the receive buffer (32 bytes) */
+#define TEST_LONG_LINE                 "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+
+/* 28 spaces (ignored before a name): in a burst only "stop" fits in the receive buffer, " 5\n" is dropped */
+#define TEST_SPACES                    "                            "
+
+static const Test_StepType g_steps[] =
+{
+	{"stop\n",                          Command_Stop,               FALSE},
+	{"START\r\n",                       Command_Start,              FALSE},
+	{"lap\n",                           Command_Lap,                FALSE},
+	{"mode 0\n",                        Command_Mode,               FALSE},
+	{"mode 3\n",                        TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"bright 8\n",                      Command_Bright,             FALSE},
+	{"bright 17\n",                     TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"bright 0\n",                      TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"stop 1\n",                        TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"stop  0\n",                       Command_Stop,               FALSE},
+	{"reset\n",                         Command_Reset,              FALSE},
+	{"status\n",                        Command_Status,             FALSE},
+	{"start 255\n",                     TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"lap 0 0\n",                       TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"go\n",                            TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"start\n",                         Command_Start,              FALSE},
+	{TEST_LONG_LINE "\n",               TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"status\n",                        Command_Status,             FALSE},
+	{TEST_LONG_LINE "\nstatus\n",       TEST_NO_ACK,                TRUE},
+	{"status\n",                        TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"status\n",                        Command_Status,             FALSE},
+	{TEST_SPACES "stop 5\n",            TEST_NO_ACK,                TRUE},
+	{"\n",                              TELEMETRY_COMMAND_ERROR,    FALSE},
+	{"status\n",                        Command_Status,             FALSE}
+};
+
+static uint32 g_ms = 0;
+static uint8 g_step = 0;
+
+/* Records of the current step */
+static uint8 g_acks;
+static uint8 g_ack;
+static uint32 g_latency;
+static uint8 g_laps;
+static uint8 g_timeRecords;
+static uint8 g_faultRecords;
+
+static uint32 Test_TimeMs(void)
+{
+	StopWatch_TimeType time;
+
+	StopWatch_GetTime(0, &time);
+	return ((((((uint32)time.hours * 60UL) + time.minutes) * 60UL) + time.seconds) * 1000UL) + time.milliseconds;
+}
+
+static void Test_ReadRecords(void)
+{
+	Host_Test_RecordType record;
+
+	while (Host_Test_ReadRecord(&record) == TRUE)
+	{
+		switch (record.type)
+		{
+		case TELEMETRY_COMMAND_RECORD:
+			g_acks++;
+			g_ack = record.argument;
+			g_latency = record.value;
+			break;
+		case TELEMETRY_LAP_RECORD:
+			g_laps++;
+			break;
+		case TELEMETRY_TIME_RECORD:
+			g_timeRecords++;
+			break;
+		case TELEMETRY_FAULT_RECORD:
+			g_faultRecords++;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/* What the command of the step did, besides its acknowledgement */
+static void Test_CheckStep(void)
+{
+	switch (g_step)
+	{
+	case 0:
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == FALSE);
+		break;
+	case 1:
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == TRUE);
+		break;
+	case 2:
+		HOST_TEST_CHECK(g_laps == 1);
+		break;
+	case 3:
+	case 4:
+		HOST_TEST_CHECK(StopWatch_GetDisplayMode() == StopWatch_SS_mmm);
+		break;
+	case 8:
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == TRUE);
+		break;
+	case 9:
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == FALSE);
+		break;
+	case 10:
+		HOST_TEST_CHECK(Test_TimeMs() == 0);
+		break;
+	case 11:
+		HOST_TEST_CHECK((g_timeRecords >= 1) && (g_faultRecords == 1));
+		break;
+	case 13:
+		HOST_TEST_CHECK(g_laps == 0);
+		break;
+	case 15:
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == TRUE);
+		break;
+	case 16:
+	case 17:
+		/* Parsed while it came: the long line did not fill the receive buffer */
+		HOST_TEST_CHECK(UART_GetRxDropped() == 0);
+		break;
+	case 18:
+		/* 48 characters at once in a 32 bytes buffer */
+		HOST_TEST_CHECK(UART_GetRxDropped() == 16);
+		break;
+	case 21:
+	case 22:
+		/* The line which lost its end is not taken for "stop" of the displayed channel */
+		HOST_TEST_CHECK(UART_GetRxDropped() == (16 + 3));
+		HOST_TEST_CHECK(StopWatch_IsRunning(0) == TRUE);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	uint8 character;
+
+	Host_Test_Tick();
+	g_ms++;
+
+	if ((g_ms % TEST_STEP_MS) == 0)
+	{
+		if (g_ms > TEST_STEP_MS)
+		{
+			/* End of the previous step */
+			Test_ReadRecords();
+			if (g_steps[g_step].ack == TEST_NO_ACK)
+			{
+				HOST_TEST_CHECK(g_acks == 0);
+			}
+			else
+			{
+				HOST_TEST_CHECK(g_acks == 1);
+				HOST_TEST_CHECK(g_ack == g_steps[g_step].ack);
+				/* From the end of the line to the execution: within the millisecond of the next tick */
+				HOST_TEST_CHECK(g_latency < (2UL * TIMER1_TICK_COUNTS));
+			}
+			Test_CheckStep();
+			g_step++;
+			if (g_step == TEST_NUM_OF_STEPS)
+			{
+				exit(Host_Test_Result("Test_Command"));
+			}
+		}
+		else
+		{
+			/* The records sent at the boot */
+			Test_ReadRecords();
+		}
+
+		g_acks = 0;
+		g_laps = 0;
+		g_timeRecords = 0;
+		g_faultRecords = 0;
+		Host_Test_UartType(g_steps[g_step].line);
+		for (character = 0; (g_steps[g_step].burst == TRUE) && (character < strlen(g_steps[g_step].line)); character++)
+		{
+			Host_Test_UartReceive();
+		}
+	}
+
+	Host_Test_UartReceive();
+	while (Host_Test_UartTransmit() == TRUE)
+	{
+	}
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,64 @@
+/*******************************************************************************************************************
+ * File Name: Test_Debounce.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Buttons Debouncing with the Software Timers Pool Full (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built with TIMER1_NUM_OF_SOFT_TIMERS = APPLICATION_NUM_OF_SOFT_TIMERS (7). A press disables its interrupt for the
+ * bounce time, then the test takes all the free software timers: the next press can not start its debounce timer,
+ * so its interrupt must be enabled again at once instead of staying disabled for ever.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdlib.h>
+#include "TIMER1.h"
+
+static uint32 g_ms = 0;
+
+static void Test_Nothing(void)
+{
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	Host_Test_Tick();
+	g_ms++;
+
+	switch (g_ms)
+	{
+	case 100:
+		HOST_TEST_CHECK(GICR & (1 << INT1));
+		Host_FireVector(INT1_vect_num);
+		break;
+	case 101:
+		/* Bouncing: disabled until the debounce timer expires */
+		HOST_TEST_CHECK(!(GICR & (1 << INT1)));
+		break;
+	case 200:
+		HOST_TEST_CHECK(GICR & (1 << INT1));
+		/* Take the free software timers (the application keeps 4 running) */
+		while (Timer1_SoftTimer_Start(60000, Timer1_OneShot, Test_Nothing) != TIMER1_INVALID_SOFT_TIMER)
+		{
+		}
+		Host_FireVector(INT1_vect_num);
+		break;
+	case 201:
+		/* The press was handled without a debounce timer: the interrupt is enabled again */
+		HOST_TEST_CHECK(GICR & (1 << INT1));
+		exit(Host_Test_Result("Test_Debounce"));
+		break;
+	}
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,163 @@
+/*******************************************************************************************************************
+ * File Name: Test_EventQueue.c
+ * Date: 16/10/2026
+ * Driver: Host Stress Test of the Scheduler Events Queue (Single Producer, Single Consumer) (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The producer is a SIGALRM handler: it interrupts the consumer (Scheduler_Run()) at any instruction, like an ISR,
+ * at random intervals and posts a random burst of 1 .. 24 events (more than the queue size). An interrupt which
+ * comes while the I-bit is cleared is not taken (on the AVR it would come after sei(), the next one is as good).
+ * The events are posted in sequence (event = sequence number modulo SCHEDULER_NUM_OF_EVENTS, a rejected event is
+ * posted again by the next burst) and every handler spends a random time, so the queue also runs full. The handlers
+ * check that every event comes once and in order, and at the end the lost events counted by the scheduler must be
+ * the rejections seen by the producer (fewer than 65536, the counter is 16-bit).
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Scheduler.h"
+
+#define TEST_EVENTS                    250000UL
+
+#if (SCHEDULER_NUM_OF_EVENTS != 12)
+#error "The test has one handler for each of the 12 events"
+#endif
+
+/* Producer (signal handler) */
+static volatile uint32 g_posted = 0;
+static volatile uint32 g_rejected = 0;
+static volatile uint32 g_interrupts = 0;
+static volatile uint32 g_deferred = 0;
+static unsigned int g_producerSeed = 1;
+
+/* Consumer (handlers) */
+static uint32 g_handled = 0;
+static uint32 g_outOfOrder = 0;
+static unsigned int g_consumerSeed = 2;
+static volatile boolean g_stopped = FALSE;
+
+/* The next interrupt after 5 .. 60 us */
+static void Test_ArmProducer(void)
+{
+	struct itimerval next = {{0, 0}, {0, 0}};
+
+	next.it_value.tv_usec = 5 + (rand_r(&g_producerSeed) % 56);
+	setitimer(ITIMER_REAL, &next, NULL);
+}
+
+/* The "ISR": the I-bit is cleared while it runs, as on the AVR */
+static void Test_Producer(int signal)
+{
+	uint8 sreg = SREG;
+	uint8 burst;
+
+	(void)signal;
+	g_interrupts++;
+	if (sreg & (1 << SREG_I))
+	{
+		SREG = sreg & ~(1 << SREG_I);
+		for (burst = (uint8)(1 + (rand_r(&g_producerSeed) % 24)); burst > 0; burst--)
+		{
+			if (Scheduler_PostEvent((Scheduler_EventType)(g_posted % SCHEDULER_NUM_OF_EVENTS)) == TRUE)
+			{
+				g_posted++;
+			}
+			else
+			{
+				g_rejected++;
+			}
+		}
+		SREG = sreg;
+	}
+	else
+	{
+		g_deferred++;
+	}
+	if (g_stopped == FALSE)
+	{
+		Test_ArmProducer();
+	}
+}
+
+static void Test_Handled(Scheduler_EventType event)
+{
+	volatile uint16 delay;
+	sigset_t alarm;
+
+	if (event != (g_handled % SCHEDULER_NUM_OF_EVENTS))
+	{
+		g_outOfOrder++;
+	}
+	g_handled++;
+
+	/* Sometimes slower than the producer, so the queue runs full */
+	for (delay = (uint16)(rand_r(&g_consumerSeed) % 400); delay > 0; delay--)
+	{
+	}
+
+	if ((g_handled == TEST_EVENTS) && (g_stopped == FALSE))
+	{
+		/* No interrupt after this one: the queue is emptied, then the sleep hook ends the test */
+		g_stopped = TRUE;
+		sigemptyset(&alarm);
+		sigaddset(&alarm, SIGALRM);
+		sigprocmask(SIG_BLOCK, &alarm, NULL);
+	}
+}
+
+#define TEST_HANDLER(event)            static void Test_Handler##event(void) { Test_Handled(event); }
+TEST_HANDLER(0) TEST_HANDLER(1) TEST_HANDLER(2) TEST_HANDLER(3) TEST_HANDLER(4) TEST_HANDLER(5)
+TEST_HANDLER(6) TEST_HANDLER(7) TEST_HANDLER(8) TEST_HANDLER(9) TEST_HANDLER(10) TEST_HANDLER(11)
+
+static void (* const g_handlers[SCHEDULER_NUM_OF_EVENTS])(void) =
+{
+	Test_Handler0, Test_Handler1, Test_Handler2, Test_Handler3, Test_Handler4, Test_Handler5,
+	Test_Handler6, Test_Handler7, Test_Handler8, Test_Handler9, Test_Handler10, Test_Handler11
+};
+
+/* Sleep hook: the queue is empty, once the producer is stopped every posted event must have been handled */
+static void Test_Idle(void)
+{
+	if (g_stopped == FALSE)
+	{
+		return;
+	}
+
+	printf("%lu interrupts (%lu while the I-bit was cleared): %lu events posted, %lu handled, %lu rejected, "
+	       "%u lost\n", (unsigned long)g_interrupts, (unsigned long)g_deferred, (unsigned long)g_posted,
+	       (unsigned long)g_handled, (unsigned long)g_rejected, (unsigned)Scheduler_GetLostEvents());
+
+	HOST_TEST_CHECK(g_handled == g_posted);
+	HOST_TEST_CHECK(g_outOfOrder == 0);
+	HOST_TEST_CHECK(g_rejected > 0);
+	HOST_TEST_CHECK(g_rejected < 65536UL);
+	HOST_TEST_CHECK(Scheduler_GetLostEvents() == g_rejected);
+	exit(Host_Test_Result("Test_EventQueue"));
+}
+
+int main(void)
+{
+	Scheduler_EventType event;
+
+	Host_Reset();
+	Scheduler_Init();
+	for (event = 0; event < SCHEDULER_NUM_OF_EVENTS; event++)
+	{
+		Scheduler_SetHandler(event, g_handlers[event]);
+	}
+	Host_SetSleepHook(Test_Idle);
+
+	signal(SIGALRM, Test_Producer);
+	sei();
+	Test_ArmProducer();
+	Scheduler_Run();
+	return 1;
+}
+
+#endif /* __AVR__ */
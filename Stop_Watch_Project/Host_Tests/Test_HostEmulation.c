@@ -0,0 +1,82 @@
+/*******************************************************************************************************************
+ * File Name: Test_HostEmulation.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Register File Emulation and the MCAL Drivers (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The drivers write the emulated registers as they write the real ones, and the vectors are executed
+ * only when the I-bit and their enable bits are set (otherwise they stay pending).
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "GPIO.h"
+#include "INT.h"
+#include "TIMER1.h"
+
+static uint32 g_int0Count = 0;
+static uint32 g_tickCount = 0;
+
+ISR(INT0_vect)
+{
+	g_int0Count++;
+}
+
+static void Tick(void)
+{
+	g_tickCount++;
+}
+
+int main(void)
+{
+	Timer1_ConfigType timer1Config = {0, TIMER1_TICK_COMPARE_VALUE, TIMER1_TICK_PRESCALER, CTC_4};
+
+	Host_Reset();
+
+	/* GPIO: direction, output and input registers */
+	GPIO_SetupPinDirection(PORTA_ID, PIN3_ID, OUTPUT_PIN);
+	GPIO_WritePin(PORTA_ID, PIN3_ID, LOGIC_HIGH);
+	HOST_TEST_CHECK(DDRA == (1 << PIN3_ID));
+	HOST_TEST_CHECK(PORTA == (1 << PIN3_ID));
+	GPIO_WritePortMasked(PORTC_ID, 0x0F, 0x05);
+	HOST_TEST_CHECK((PORTC & 0x0F) == 0x05);
+	PINB = (1 << PIN2_ID);
+	HOST_TEST_CHECK(GPIO_ReadPin(PORTB_ID, PIN2_ID) == LOGIC_HIGH);
+
+	/* INT0: the edge and enable bits, a request is pending while the I-bit is cleared */
+	INT0_Init(INT0_FALLING_EDGE);
+	HOST_TEST_CHECK(GICR & (1 << INT0));
+	HOST_TEST_CHECK((MCUCR & ((1 << ISC01) | (1 << ISC00))) == (1 << ISC01));
+	HOST_TEST_CHECK(Host_FireVector(INT0_vect_num) == 0);
+	HOST_TEST_CHECK(g_int0Count == 0);
+	sei();
+	Host_ServicePendingVectors();
+	HOST_TEST_CHECK(g_int0Count == 1);
+	HOST_TEST_CHECK(!(GIFR & (1 << INTF0)));
+	INT0_DeInit();
+	HOST_TEST_CHECK(Host_FireVector(INT0_vect_num) == 0);
+	HOST_TEST_CHECK(g_int0Count == 1);
+
+	/* Timer1: CTC time base, every compare match calls the tick call back */
+	Timer1_SetCallBack(Tick);
+	Timer1_NonPWm_Mode_Init(&timer1Config);
+	HOST_TEST_CHECK(OCR1A == TIMER1_TICK_COMPARE_VALUE);
+	HOST_TEST_CHECK(TCCR1B & (1 << WGM12));
+	HOST_TEST_CHECK(TIMSK & (1 << OCIE1A));
+	Host_Test_Ticks(1000);
+	HOST_TEST_CHECK(g_tickCount == 1000);
+
+	/* The I-bit is cleared while an ISR runs and set again at its end */
+	cli();
+	HOST_TEST_CHECK(Host_FireVector(TIMER1_COMPA_vect_num) == 0);
+	sei();
+	Host_ServicePendingVectors();
+	HOST_TEST_CHECK(g_tickCount == 1001);
+	HOST_TEST_CHECK(SREG & (1 << SREG_I));
+
+	return Host_Test_Result("Test_HostEmulation");
+}
+
+#endif /* __AVR__ */
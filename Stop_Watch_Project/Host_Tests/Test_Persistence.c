@@ -0,0 +1,124 @@
+/*******************************************************************************************************************
+ * File Name: Test_Persistence.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Wear-Leveled EEPROM Ring (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Every save is found again after a power cycle, also when the newest save was cut by a power loss just after
+ * the sequence number wrapped around (0xFFFE, then 0: 0xFFFF is the erased sequence number and never written).
+ * A power loss before the last byte of a save is emulated by writing the save completely, then putting back
+ * the previous value of the last EEPROM byte it changed (the slot is written in the address order).
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <string.h>
+#include "EEPROM.h"
+#include "Persistence.h"
+
+/* The emulated EEPROM (see Host_Emulation/avr/eeprom.h) */
+extern uint8 __start_host_eeprom[];
+extern uint8 __stop_host_eeprom[];
+
+#define EEPROM_SIZE                                ((uint32)(__stop_host_eeprom - __start_host_eeprom))
+
+/* The saves done by the test, save n has the time of n seconds */
+#define NUM_OF_SAVES                               0x10000UL
+
+static uint8 g_before[E2END + 1];
+
+static void Test_SetData(Persistence_DataType * data, uint32 save)
+{
+	memset(data, 0, sizeof(Persistence_DataType));
+	data -> time[0].hours = (uint8)(save / 3600);
+	data -> time[0].minutes = (uint8)((save / 60) % 60);
+	data -> time[0].seconds = (uint8)(save % 60);
+	data -> lap_count[0] = (uint8)save;
+}
+
+static boolean Test_IsData(const Persistence_DataType * data, uint32 save)
+{
+	return ((data -> time[0].hours == (uint8)(save / 3600)) && (data -> time[0].minutes == (uint8)((save / 60) % 60)) &&
+	        (data -> time[0].seconds == (uint8)(save % 60)) && (data -> lap_count[0] == (uint8)save)) ? TRUE : FALSE;
+}
+
+/* Save and let the EEPROM ready interrupt write the whole slot */
+static boolean Test_Save(uint32 save)
+{
+	Persistence_DataType data;
+
+	Test_SetData(&data, save);
+	if (Persistence_Save(&data) == FALSE)
+	{
+		return FALSE;
+	}
+	while (EEPROM_IsBusy() == TRUE)
+	{
+		Host_ServicePendingVectors();
+	}
+	return TRUE;
+}
+
+/* Put back the previous value of the last byte changed by the last save */
+static void Test_CutLastByte(void)
+{
+	uint32 address = EEPROM_SIZE;
+
+	while (address > 0)
+	{
+		address--;
+		if (__start_host_eeprom[address] != g_before[address])
+		{
+			__start_host_eeprom[address] = g_before[address];
+			return;
+		}
+	}
+}
+
+int main(void)
+{
+	Persistence_DataType data;
+	uint32 save;
+	boolean saved = TRUE;
+
+	HOST_TEST_CHECK((EEPROM_SIZE > 0) && (EEPROM_SIZE <= sizeof(g_before)));
+	memset(__start_host_eeprom, 0xFF, EEPROM_SIZE);
+	sei();
+
+	/* Erased EEPROM: nothing to restore, the first save has the sequence number 0 */
+	HOST_TEST_CHECK(Persistence_Restore(&data) == FALSE);
+
+	/* The sequence numbers 0 .. 0xFFFE: the next save wraps around to 0 */
+	for (save = 0; save < (NUM_OF_SAVES - 1); save++)
+	{
+		if (Test_Save(save) == FALSE)
+		{
+			saved = FALSE;
+		}
+	}
+	HOST_TEST_CHECK(saved == TRUE);
+	HOST_TEST_CHECK((Persistence_Restore(&data) == TRUE) && (Test_IsData(&data, NUM_OF_SAVES - 2) == TRUE));
+
+	/* The first save after the wrap around is cut: the last save before it (0xFFFE) is restored */
+	memcpy(g_before, __start_host_eeprom, EEPROM_SIZE);
+	HOST_TEST_CHECK(Test_Save(NUM_OF_SAVES - 1) == TRUE);
+	HOST_TEST_CHECK((Persistence_Restore(&data) == TRUE) && (Test_IsData(&data, NUM_OF_SAVES - 1) == TRUE));
+	Test_CutLastByte();
+	HOST_TEST_CHECK((Persistence_Restore(&data) == TRUE) && (Test_IsData(&data, NUM_OF_SAVES - 2) == TRUE));
+
+	/* The ring continues after the cut slot */
+	HOST_TEST_CHECK(Test_Save(NUM_OF_SAVES) == TRUE);
+	HOST_TEST_CHECK((Persistence_Restore(&data) == TRUE) && (Test_IsData(&data, NUM_OF_SAVES) == TRUE));
+
+	/* A save cut in the middle of the ring turn: the save before it is restored */
+	memcpy(g_before, __start_host_eeprom, EEPROM_SIZE);
+	HOST_TEST_CHECK(Test_Save(NUM_OF_SAVES + 1) == TRUE);
+	Test_CutLastByte();
+	HOST_TEST_CHECK((Persistence_Restore(&data) == TRUE) && (Test_IsData(&data, NUM_OF_SAVES) == TRUE));
+
+	return Host_Test_Result("Test_Persistence");
+}
+
+#endif /* __AVR__ */
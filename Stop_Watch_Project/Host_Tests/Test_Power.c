@@ -0,0 +1,161 @@
+/*******************************************************************************************************************
+ * File Name: Test_Power.c
+ * Date: 16/10/2026
+ * Driver: Host Measurement of the CPU Wake-Ups with the Display On and Off (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The application sleeps (idle mode) whenever it has nothing to do, so every sleep hook call is one sleep and the
+ * interrupt fired by the hook is the next wake-up. The hook keeps a timeline in CPU cycles of the three interrupt
+ * sources running while the CPU sleeps, from their registers: the Timer1 tick (OCR1A), the Timer0 display slots
+ * (OCR0 and TCCR0, while OCIE0 is set) and the UART transmitter (one byte time from UBRR while UDRIE is set), and
+ * fires the earliest one. The wake-ups per second are counted from 10 s to 20 s (display on) and from 70 s to
+ * 80 s (display off after DISPLAY_OFF_TIMEOUT_MS = 60 s without a button press).
+ * The host has no cycle count of the AVR code: the awake time is the wake-ups times the cycles of one wake-up
+ * (interrupt + handlers), measured by the simavr benchmark.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <avr/io.h>
+#include "TIMER1.h"
+
+#define TEST_SOURCES                   3
+#define TEST_TIMER1                    0
+#define TEST_TIMER0                    1
+#define TEST_UART                      2
+
+#define TEST_CYCLES_PER_MS             (F_CPU / 1000UL)
+#define TEST_ON_START_MS               10000ULL
+#define TEST_OFF_START_MS              70000ULL
+#define TEST_WINDOW_MS                 10000ULL
+
+static const char * const g_sourceNames[TEST_SOURCES] = {"Timer1 tick", "Timer0 display", "UART byte"};
+static const uint16 g_timer0Prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+
+/* Timeline in CPU cycles: the next interrupt of every source (0 = not running) */
+static uint64 g_now = 0;
+static uint64 g_next[TEST_SOURCES] = {0, 0, 0};
+static uint32 g_sleeps = 0;
+/* Wake-ups counted in the display on [0] and display off [1] windows */
+static uint32 g_wakeUps[2][TEST_SOURCES];
+
+/* Cycles until the next interrupt of the source, 0 if it is not running */
+static uint64 Test_Period(uint8 source)
+{
+	uint16 ubrr;
+
+	switch (source)
+	{
+	case TEST_TIMER1:
+		return ((uint64)OCR1A + 1) * TIMER1_TICK_PRESCALER_VALUE;
+	case TEST_TIMER0:
+		if (!(TIMSK & (1 << OCIE0)) || (g_timer0Prescalers[TCCR0 & 0x07] == 0))
+		{
+			return 0;
+		}
+		return ((uint64)OCR0 + 1) * g_timer0Prescalers[TCCR0 & 0x07];
+	default:
+		if (!(UCSRB & (1 << UDRIE)))
+		{
+			return 0;
+		}
+		/* 10 bits (start, 8 data, stop) of (UBRR + 1) * 8 cycles in double speed mode */
+		ubrr = (uint16)(((UBRRH & 0x0F) << 8) | UBRRL);
+		return 10ULL * ((uint64)ubrr + 1) * ((UCSRA & (1 << U2X)) ? 8 : 16);
+	}
+}
+
+static void Test_Report(uint8 window, const char * name)
+{
+	uint32 total = 0;
+	uint8 source;
+
+	printf("display %s:", name);
+	for (source = 0; source < TEST_SOURCES; source++)
+	{
+		printf(" %s %lu/s,", g_sourceNames[source], (unsigned long)(g_wakeUps[window][source] / (TEST_WINDOW_MS / 1000)));
+		total += g_wakeUps[window][source];
+	}
+	printf(" total %lu wake-ups/s = %.2f per tick\n", (unsigned long)(total / (TEST_WINDOW_MS / 1000)),
+	       (double)total / (double)g_wakeUps[window][TEST_TIMER1]);
+}
+
+/* Sleep hook: fire the next interrupt of the timeline, it wakes the CPU up */
+static void Test_Sleep(void)
+{
+	uint64 ms;
+	uint8 source;
+	uint8 earliest = TEST_TIMER1;
+
+	g_sleeps++;
+
+	/* Start or stop the timeline of the sources turned on or off since the last sleep */
+	for (source = 0; source < TEST_SOURCES; source++)
+	{
+		if (Test_Period(source) == 0)
+		{
+			g_next[source] = 0;
+		}
+		else if (g_next[source] == 0)
+		{
+			g_next[source] = g_now + Test_Period(source);
+		}
+		if ((g_next[source] != 0) && (g_next[source] < g_next[earliest]))
+		{
+			earliest = source;
+		}
+	}
+
+	g_now = g_next[earliest];
+	ms = g_now / TEST_CYCLES_PER_MS;
+	if ((ms >= TEST_ON_START_MS) && (ms < (TEST_ON_START_MS + TEST_WINDOW_MS)))
+	{
+		g_wakeUps[0][earliest]++;
+	}
+	else if ((ms >= TEST_OFF_START_MS) && (ms < (TEST_OFF_START_MS + TEST_WINDOW_MS)))
+	{
+		g_wakeUps[1][earliest]++;
+	}
+	else if (ms >= (TEST_OFF_START_MS + TEST_WINDOW_MS))
+	{
+		Test_Report(0, "on ");
+		Test_Report(1, "off");
+		printf("%lu sleeps in %lu ms\n", (unsigned long)g_sleeps, (unsigned long)ms);
+
+		/* Display on: one tick every millisecond and one slot every 2 ms (full brightness: one part per slot) */
+		HOST_TEST_CHECK(g_wakeUps[0][TEST_TIMER1] == TEST_WINDOW_MS);
+		HOST_TEST_CHECK(g_wakeUps[0][TEST_TIMER0] == (TEST_WINDOW_MS / 2));
+		/* Display off: the refresh interrupt is stopped, only the tick and the telemetry wake the CPU up */
+		HOST_TEST_CHECK(g_wakeUps[1][TEST_TIMER1] == TEST_WINDOW_MS);
+		HOST_TEST_CHECK(g_wakeUps[1][TEST_TIMER0] == 0);
+		HOST_TEST_CHECK(g_wakeUps[1][TEST_UART] == g_wakeUps[0][TEST_UART]);
+		exit(Host_Test_Result("Test_Power"));
+	}
+
+	/* Fire the interrupt, its next one comes one period later (read after the ISR, it may change the period) */
+	if (earliest == TEST_TIMER1)
+	{
+		Host_Test_Tick();
+	}
+	else if (earliest == TEST_TIMER0)
+	{
+		Host_FireVector(TIMER0_COMP_vect_num);
+	}
+	else
+	{
+		Host_Test_UartTransmit();
+	}
+	g_next[earliest] = (Test_Period(earliest) == 0) ? 0 : (g_now + Test_Period(earliest));
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Sleep);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
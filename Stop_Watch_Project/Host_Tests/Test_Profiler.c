@@ -0,0 +1,171 @@
+/*******************************************************************************************************************
+ * File Name: Test_Profiler.c
+ * Date: 17/10/2026
+ * Driver: Host Test of the Interrupt Latency and Duration Profiler (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built with PROFILER_ENABLE = TRUE and the application. TCNT1 only changes when the test writes it, so the test
+ * sets where every interrupt starts in the tick: the Timer1 ticks entered at TCNT1 3 .. 7 give a latency of
+ * 3 / 5 / 7 (min / mean / max), the pause button posted at TCNT1 100 and handled at TCNT1 350 gives 250.
+ * Then 20 ticks in a log of 16 measurements: the 4 oldest are overwritten, the statistics keep all of them.
+ * Last the Timer0 display slots and the UART interrupts are recorded under their own IDs.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdlib.h>
+#include "Profiler.h"
+
+/* PAUSE_BUTTON_EVENT of the application */
+#define TEST_PAUSE_EVENT               1
+
+/* Where the pause button ISR and its handler start in the tick */
+#define TEST_POST_COUNT                100
+#define TEST_HANDLER_COUNT             350
+
+#define TEST_OVERWRITE_TICKS           20
+
+static uint32 g_ms = 0;
+
+/* Ticks entered at TCNT1 3 .. 7 */
+static void Test_TickLatency(void)
+{
+	Profiler_StatsType stats;
+	uint16 count;
+
+	Profiler_Reset();
+	for (count = 3; count <= 7; count++)
+	{
+		TCNT1 = count;
+		Host_FireVector(TIMER1_COMPA_vect_num);
+	}
+
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_TIMER1_COMPA_ID, &stats) == TRUE);
+	HOST_TEST_CHECK(stats.count == 5);
+	HOST_TEST_CHECK((stats.min_latency == 3) && (stats.mean_latency == 5) && (stats.max_latency == 7));
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_INT1_ID, &stats) == FALSE);
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_NUM_OF_IDS, &stats) == FALSE);
+}
+
+/* The pause button pressed at TCNT1 100, its handler runs when the test returns with TCNT1 at 350 */
+static void Test_PressPost(void)
+{
+	Profiler_Reset();
+	TCNT1 = TEST_POST_COUNT;
+	Host_FireVector(INT1_vect_num);
+	TCNT1 = TEST_HANDLER_COUNT;
+}
+
+static void Test_PressHandled(void)
+{
+	Profiler_StatsType stats;
+	Profiler_RecordType record;
+	boolean handled = FALSE;
+
+	/* The ISR first, then the handler (after the events of the tick, if any) */
+	HOST_TEST_CHECK(Profiler_GetRecord(&record) == TRUE);
+	HOST_TEST_CHECK((record.id == PROFILER_INT1_ID) && (record.latency == TEST_POST_COUNT));
+	while (Profiler_GetRecord(&record) == TRUE)
+	{
+		if (record.id == (PROFILER_FIRST_EVENT_ID + TEST_PAUSE_EVENT))
+		{
+			HOST_TEST_CHECK(record.latency == (TEST_HANDLER_COUNT - TEST_POST_COUNT));
+			handled = TRUE;
+		}
+	}
+	HOST_TEST_CHECK(handled == TRUE);
+
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_FIRST_EVENT_ID + TEST_PAUSE_EVENT, &stats) == TRUE);
+	HOST_TEST_CHECK((stats.count == 1) && (stats.mean_latency == (TEST_HANDLER_COUNT - TEST_POST_COUNT)));
+}
+
+/* More measurements than the log keeps: the oldest are overwritten and read in order */
+static void Test_Overwrite(void)
+{
+	Profiler_StatsType stats;
+	Profiler_RecordType record;
+	uint16 tick;
+
+	Profiler_Reset();
+	for (tick = 0; tick < TEST_OVERWRITE_TICKS; tick++)
+	{
+		TCNT1 = tick * 10;
+		Host_FireVector(TIMER1_COMPA_vect_num);
+	}
+
+	for (tick = TEST_OVERWRITE_TICKS - PROFILER_LOG_SIZE; tick < TEST_OVERWRITE_TICKS; tick++)
+	{
+		HOST_TEST_CHECK(Profiler_GetRecord(&record) == TRUE);
+		HOST_TEST_CHECK((record.id == PROFILER_TIMER1_COMPA_ID) && (record.latency == (tick * 10)));
+	}
+	HOST_TEST_CHECK(Profiler_GetRecord(&record) == FALSE);
+
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_TIMER1_COMPA_ID, &stats) == TRUE);
+	HOST_TEST_CHECK((stats.count == TEST_OVERWRITE_TICKS) && (stats.min_latency == 0));
+	HOST_TEST_CHECK(stats.max_latency == ((TEST_OVERWRITE_TICKS - 1) * 10));
+}
+
+/* The display slots and the UART */
+static void Test_OtherIsrs(void)
+{
+	Profiler_StatsType stats;
+	char digits[7];
+
+	Profiler_Reset();
+	TCNT1 = 20;
+	Host_Test_ReadDisplay(digits);
+	Host_Test_UartType("\n");
+	Host_Test_UartReceive();
+	while (Host_Test_UartTransmit() == TRUE)
+	{
+	}
+
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_TIMER0_COMP_ID, &stats) == TRUE);
+	HOST_TEST_CHECK((stats.count == 6) && (stats.mean_latency == 20));
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_USART_RXC_ID, &stats) == TRUE);
+	HOST_TEST_CHECK(stats.count == 1);
+	/* The telemetry of the pause button, one interrupt per byte and the last one stops the interrupt */
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_USART_UDRE_ID, &stats) == TRUE);
+	HOST_TEST_CHECK(stats.count > 1);
+	HOST_TEST_CHECK(Profiler_GetStats(PROFILER_INT0_ID, &stats) == FALSE);
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps, the checks come before the tick */
+static void Test_Step(void)
+{
+	switch (g_ms)
+	{
+	case 1000:
+		Test_TickLatency();
+		break;
+	case 1001:
+		Test_PressPost();
+		/* The handler must run with TCNT1 where the test left it */
+		g_ms++;
+		return;
+	case 1002:
+		Test_PressHandled();
+		break;
+	case 1003:
+		Test_Overwrite();
+		break;
+	case 1004:
+		Test_OtherIsrs();
+		exit(Host_Test_Result("Test_Profiler"));
+		break;
+	}
+
+	Host_Test_Tick();
+	g_ms++;
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,174 @@
+/*******************************************************************************************************************
+ * File Name: Test_Pwm.c
+ * Date: 17/10/2026
+ * Driver: Host Test of the Timer1 PWM Configuration and Duty Cycle Updates (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * F_CPU = 1 MHz. Timer1_PWM_Init() is checked for TOP in ICR1, TOP in OCR1A and a fixed TOP, fast and dual slope:
+ * the pre-scaler and TOP computed, the WGM and COM bits, the compare values and the OC1A/OC1B pins, and the
+ * frequencies it must reject. In fast PWM the output is connected and disconnected (0%) only at TOP:
+ * the register is not changed until the test fires the overflow interrupt.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "TIMER1.h"
+
+#if (F_CPU != 1000000UL)
+#error "The expected pre-scalers and TOP values are computed for F_CPU = 1 MHz"
+#endif
+
+#define TEST_OC1A                      (1 << PD5)
+#define TEST_OC1B                      (1 << PD4)
+
+static boolean Test_Init(uint32 frequency, Timer1_Mode mode, Timer1_PwmOutput output_a, Timer1_PwmOutput output_b)
+{
+	Timer1_PwmConfigType config;
+
+	config.frequency = frequency;
+	config.mode = mode;
+	config.output_a = output_a;
+	config.output_b = output_b;
+	return Timer1_PWM_Init(&config);
+}
+
+/* TOP in ICR1, fast PWM, non-inverting OC1A: 0% and back only at TOP */
+static void Test_FastIcr1(void)
+{
+	HOST_TEST_CHECK(Test_Init(1000, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == TRUE);
+	/* Pre-scaler 1, TOP = 999: 1 MHz / 1000 */
+	HOST_TEST_CHECK((Timer1_PWM_GetTop() == 999) && (ICR1 == 999));
+	HOST_TEST_CHECK(TCCR1A == (1 << WGM11));
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM13) | (1 << WGM12) | (1 << CS10)));
+	HOST_TEST_CHECK((OCR1A == 0) && (OCR1B == 0));
+	HOST_TEST_CHECK(!(TIMSK & ((1 << OCIE1A) | (1 << TOIE1))));
+	HOST_TEST_CHECK(((DDRD & (TEST_OC1A | TEST_OC1B)) == TEST_OC1A) && !(PORTD & TEST_OC1A));
+
+	/* 25%: 250 of 1000 counts, connected at the next TOP */
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 25) == TRUE);
+	HOST_TEST_CHECK((OCR1A == 249) && (TCCR1A == (1 << WGM11)) && (TIMSK & (1 << TOIE1)));
+	Host_FireVector(TIMER1_OVF_vect_num);
+	HOST_TEST_CHECK((TCCR1A == ((1 << COM1A1) | (1 << WGM11))) && !(TIMSK & (1 << TOIE1)));
+
+	/* 0%: the current pulse ends, the output is disconnected at TOP */
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 0) == TRUE);
+	HOST_TEST_CHECK((OCR1A == 0) && (TCCR1A == ((1 << COM1A1) | (1 << WGM11))));
+	Host_FireVector(TIMER1_OVF_vect_num);
+	HOST_TEST_CHECK(TCCR1A == (1 << WGM11));
+
+	/* 0% again changes nothing, a compare value connects at TOP */
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 0) == TRUE);
+	HOST_TEST_CHECK(!(TIMSK & (1 << TOIE1)));
+	HOST_TEST_CHECK(Timer1_PWM_SetDuty(Timer1_Channel_A, 500) == TRUE);
+	HOST_TEST_CHECK((OCR1A == 500) && (TCCR1A == (1 << WGM11)));
+	Host_FireVector(TIMER1_OVF_vect_num);
+	HOST_TEST_CHECK(TCCR1A == ((1 << COM1A1) | (1 << WGM11)));
+
+	/* 0% then 40% in the same period: still connected after TOP */
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 0) == TRUE);
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 40) == TRUE);
+	Host_FireVector(TIMER1_OVF_vect_num);
+	HOST_TEST_CHECK((OCR1A == 399) && (TCCR1A == ((1 << COM1A1) | (1 << WGM11))));
+
+	/* 100% and a compare value above TOP */
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 100) == TRUE) && (OCR1A == 999));
+	HOST_TEST_CHECK((Timer1_PWM_SetDuty(Timer1_Channel_A, 5000) == TRUE) && (OCR1A == 999));
+
+	/* OC1B is not a PWM output */
+	HOST_TEST_CHECK(Timer1_PWM_SetDuty(Timer1_Channel_B, 10) == FALSE);
+	HOST_TEST_CHECK(Timer1_PWM_SetDutyPercent(Timer1_Channel_B, 10) == FALSE);
+	HOST_TEST_CHECK(OCR1B == 0);
+}
+
+/* TOP in ICR1, phase correct, inverting OC1B: always connected, the duty cycle is the compare value */
+static void Test_DualSlopeIcr1(void)
+{
+	HOST_TEST_CHECK(Test_Init(50, PWM_Phase_Correct_10, Timer1_PWM_Disconnected, Timer1_PWM_Inverting) == TRUE);
+	/* Pre-scaler 1, TOP = 10000: 1 MHz / (2 * 10000) */
+	HOST_TEST_CHECK((Timer1_PWM_GetTop() == 10000) && (ICR1 == 10000));
+	HOST_TEST_CHECK(TCCR1A == ((1 << COM1B1) | (1 << COM1B0) | (1 << WGM11)));
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM13) | (1 << CS10)));
+	/* The inverting output is off when high */
+	HOST_TEST_CHECK((DDRD & TEST_OC1B) && (PORTD & TEST_OC1B));
+
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_B, 30) == TRUE) && (OCR1B == 3000));
+	HOST_TEST_CHECK(!(TIMSK & (1 << TOIE1)));
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_B, 0) == TRUE) && (OCR1B == 0));
+	HOST_TEST_CHECK(TCCR1A == ((1 << COM1B1) | (1 << COM1B0) | (1 << WGM11)));
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_B, 100) == TRUE) && (OCR1B == 10000));
+	HOST_TEST_CHECK(Timer1_PWM_SetDuty(Timer1_Channel_A, 10) == FALSE);
+}
+
+/* TOP fixed by the mode: only the pre-scaler is chosen, a frequency between two pre-scalers is rejected */
+static void Test_FixedTop(void)
+{
+	/* 1 MHz / 256 = 3906.25 Hz with pre-scaler 1 */
+	HOST_TEST_CHECK(Test_Init(3906, Fast_Pwm_8_Bit_5, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == TRUE);
+	HOST_TEST_CHECK(Timer1_PWM_GetTop() == 255);
+	HOST_TEST_CHECK(TCCR1A == (1 << WGM10));
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM12) | (1 << CS10)));
+
+	/* 488.28 Hz with pre-scaler 8 */
+	HOST_TEST_CHECK(Test_Init(488, Fast_Pwm_8_Bit_5, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == TRUE);
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM12) | (1 << CS11)));
+
+	/* 1000 Hz is 2.0 or 3.9 times away: rejected, Timer1 is not changed */
+	HOST_TEST_CHECK(Test_Init(1000, Fast_Pwm_8_Bit_5, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM12) | (1 << CS11)));
+
+	/* Dual slope 9-bit: 1 MHz / (2 * 511) = 978.5 Hz, OC1A connected at once */
+	HOST_TEST_CHECK(Test_Init(978, PWM_Phase_Correct_9_Bit_2, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == TRUE);
+	HOST_TEST_CHECK(Timer1_PWM_GetTop() == 511);
+	HOST_TEST_CHECK(TCCR1A == ((1 << COM1A1) | (1 << WGM11)));
+	HOST_TEST_CHECK(TCCR1B == (1 << CS10));
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_A, 50) == TRUE) && (OCR1A == 256));
+}
+
+/* TOP in OCR1A: OC1A is not available, OC1B is the output */
+static void Test_Ocr1aTop(void)
+{
+	HOST_TEST_CHECK(Test_Init(2000, Fast_PWM_15, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	HOST_TEST_CHECK(Test_Init(2000, Fast_PWM_15, Timer1_PWM_Disconnected, Timer1_PWM_Non_Inverting) == TRUE);
+	HOST_TEST_CHECK((Timer1_PWM_GetTop() == 499) && (OCR1A == 499));
+	HOST_TEST_CHECK(TCCR1A == ((1 << WGM11) | (1 << WGM10)));
+	HOST_TEST_CHECK(TCCR1B == ((1 << WGM13) | (1 << WGM12) | (1 << CS10)));
+
+	HOST_TEST_CHECK(Timer1_PWM_SetDuty(Timer1_Channel_A, 100) == FALSE);
+	HOST_TEST_CHECK((Timer1_PWM_SetDutyPercent(Timer1_Channel_B, 10) == TRUE) && (OCR1B == 49));
+	Host_FireVector(TIMER1_OVF_vect_num);
+	HOST_TEST_CHECK(TCCR1A == ((1 << COM1B1) | (1 << WGM11) | (1 << WGM10)));
+	HOST_TEST_CHECK(OCR1A == 499);
+}
+
+/* Frequencies and modes which can not be generated */
+static void Test_Rejected(void)
+{
+	HOST_TEST_CHECK(Test_Init(1000, CTC_4, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	HOST_TEST_CHECK(Test_Init(0, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	HOST_TEST_CHECK(Test_Init(2000000, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	/* TOP = 2 is below the 2-bit resolution */
+	HOST_TEST_CHECK(Test_Init(400000, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	/* TOP = 6 gives 142857 Hz, 4.8% away */
+	HOST_TEST_CHECK(Test_Init(150000, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == FALSE);
+	/* TOP = 7 gives 125000 Hz exactly */
+	HOST_TEST_CHECK(Test_Init(125000, Fast_PWM_14, Timer1_PWM_Non_Inverting, Timer1_PWM_Disconnected) == TRUE);
+	HOST_TEST_CHECK(Timer1_PWM_GetTop() == 7);
+}
+
+int main(void)
+{
+	Host_Reset();
+	sei();
+
+	Test_FastIcr1();
+	Test_DualSlopeIcr1();
+	Test_FixedTop();
+	Test_Ocr1aTop();
+	Test_Rejected();
+
+	return Host_Test_Result("Test_Pwm");
+}
+
+#endif /* __AVR__ */
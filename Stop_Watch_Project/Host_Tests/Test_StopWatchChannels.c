@@ -0,0 +1,89 @@
+/*******************************************************************************************************************
+ * File Name: Test_StopWatchChannels.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Independent Stop-Watch Channels (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built by the Makefile for STOPWATCH_NUM_OF_CHANNELS = 4 and 8. The odd channels are started with channel 0 and
+ * count 1:02:03.004 of ticks (every carry), the even ones stay stopped. Then a channel is stopped, another one is
+ * reset while running, and a channel set to 23:59:59.999 wraps to 00:00:00.000 on the next tick.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include "SevenSegment.h"
+#include "StopWatch.h"
+
+#if (STOPWATCH_NUM_OF_CHANNELS < 4)
+#error "The test uses 4 channels at least"
+#endif
+
+/* 1:02:03.004 */
+#define TEST_TICKS                     3723004UL
+
+static boolean Test_TimeIs(StopWatch_ChannelType channel, uint8 hours, uint8 minutes, uint8 seconds, uint16 ms)
+{
+	StopWatch_TimeType time;
+
+	StopWatch_GetTime(channel, &time);
+	return ((time.hours == hours) && (time.minutes == minutes) && (time.seconds == seconds) &&
+	        (time.milliseconds == ms)) ? TRUE : FALSE;
+}
+
+int main(void)
+{
+	StopWatch_TimeType lastMs = {23, 59, 59, 999};
+	StopWatch_ChannelType channel;
+	uint32 tick;
+
+	Host_Reset();
+	SevenSegment_Multiplex_Init();
+	StopWatch_Init(StopWatch_HH_MM_SS);
+	for (channel = 1; channel < STOPWATCH_NUM_OF_CHANNELS; channel += 2)
+	{
+		StopWatch_Start(channel);
+	}
+
+	for (tick = 0; tick < TEST_TICKS; tick++)
+	{
+		StopWatch_Tick();
+	}
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		if ((channel == 0) || (channel & 1))
+		{
+			HOST_TEST_CHECK(StopWatch_IsRunning(channel) == TRUE);
+			HOST_TEST_CHECK(Test_TimeIs(channel, 1, 2, 3, 4) == TRUE);
+		}
+		else
+		{
+			HOST_TEST_CHECK(StopWatch_IsRunning(channel) == FALSE);
+			HOST_TEST_CHECK(Test_TimeIs(channel, 0, 0, 0, 0) == TRUE);
+		}
+	}
+
+	/* Channel 1 stopped, channel 3 reset while running, channel 2 one millisecond before the hours wrap */
+	StopWatch_Stop(1);
+	StopWatch_Reset(3);
+	HOST_TEST_CHECK(StopWatch_SetTime(2, &lastMs) == TRUE);
+	StopWatch_Start(2);
+	StopWatch_Tick();
+	HOST_TEST_CHECK(Test_TimeIs(2, 0, 0, 0, 0) == TRUE);
+	for (tick = 1; tick < 1000; tick++)
+	{
+		StopWatch_Tick();
+	}
+	HOST_TEST_CHECK(Test_TimeIs(0, 1, 2, 4, 4) == TRUE);
+	HOST_TEST_CHECK(Test_TimeIs(1, 1, 2, 3, 4) == TRUE);
+	HOST_TEST_CHECK(Test_TimeIs(2, 0, 0, 0, 999) == TRUE);
+	HOST_TEST_CHECK(Test_TimeIs(3, 0, 0, 1, 0) == TRUE);
+
+	/* The display shows the selected channel (HH:MM:SS) */
+	StopWatch_SetDisplayChannel(3);
+	HOST_TEST_CHECK(StopWatch_GetDisplayChannel() == 3);
+
+	return Host_Test_Result(TEST_NAME);
+}
+
+#endif /* __AVR__ */
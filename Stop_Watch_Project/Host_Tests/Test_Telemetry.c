@@ -0,0 +1,127 @@
+/*******************************************************************************************************************
+ * File Name: Test_Telemetry.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the UART Telemetry Stream under Full Transmit Load (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built with F_CPU = 7372800 and TELEMETRY_BAUD_RATE = 115200 (UBRR = 7 in double speed mode, one byte every
+ * 640 cycles, 11.52 bytes per millisecond). Every time the application sleeps the test fires one Timer1 tick and
+ * the UART byte times of that millisecond (from UBRR, while the UDRE interrupt is enabled), then sends two more time
+ * records (18 bytes): the transmit buffer stays full and records are dropped. After TEST_LOAD_MS the load stops and
+ * the buffer is emptied. The stream must hold only complete records with time records never going back, the dropped
+ * records must be the sends which are missing from the stream, and the stop-watch must have counted every tick.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "StopWatch.h"
+#include "Telemetry.h"
+#include "UART.h"
+
+#define TEST_LOAD_MS                   10000UL
+#define TEST_LOAD_RECORDS              2
+#define TEST_PERIOD_MS                 100UL
+
+static uint32 g_ms = 0;
+/* UART time of the current millisecond not used yet, in 1/1000 CPU cycles */
+static uint64 g_uartCredit = 0;
+static uint32 g_sends = 0;
+
+/* Cycles of one byte (start, 8 data, stop) from the UART registers, times 1000 */
+static uint64 Test_ByteTime(void)
+{
+	uint16 ubrr = (uint16)(((UBRRH & 0x0F) << 8) | UBRRL);
+
+	return 10ULL * ((uint64)ubrr + 1) * ((UCSRA & (1 << U2X)) ? 8 : 16) * 1000ULL;
+}
+
+static void Test_Check(void)
+{
+	StopWatch_TimeType time;
+	Host_Test_RecordType record;
+	uint32 records = 0;
+	uint32 timeRecords = 0;
+	uint32 backwards = 0;
+	uint32 last = 0;
+	uint32 elapsed;
+
+	while (Host_Test_ReadRecord(&record) == TRUE)
+	{
+		records++;
+		if (record.type == TELEMETRY_TIME_RECORD)
+		{
+			timeRecords++;
+			if (record.value < last)
+			{
+				backwards++;
+			}
+			last = record.value;
+		}
+	}
+
+	StopWatch_GetTime(0, &time);
+	elapsed = ((((((uint32)time.hours * 60UL) + time.minutes) * 60UL) + time.seconds) * 1000UL) + time.milliseconds;
+	printf("%lu ms at 115200 baud: %lu bytes, %lu records (%lu time), %u dropped, %lu bad bytes, last time %lu ms\n",
+	       (unsigned long)g_ms, (unsigned long)Host_Test_GetUartBytes(), (unsigned long)records,
+	       (unsigned long)timeRecords, (unsigned)UART_GetTxDropped(), (unsigned long)Host_Test_GetBadBytes(),
+	       (unsigned long)last);
+
+	/* Only complete records: UART_Send() copies a whole record or nothing */
+	HOST_TEST_CHECK(Host_Test_GetBadBytes() == 0);
+	HOST_TEST_CHECK(Host_Test_GetUartBytes() == (records * TELEMETRY_RECORD_SIZE));
+	HOST_TEST_CHECK(backwards == 0);
+	HOST_TEST_CHECK((last <= g_ms) && ((last + TEST_PERIOD_MS) >= g_ms));
+	/* Every send (the load, one fault record at the boot and one time record every period) sent or counted dropped */
+	HOST_TEST_CHECK(UART_GetTxDropped() > 0);
+	HOST_TEST_CHECK((records + UART_GetTxDropped()) == (g_sends + 1 + (g_ms / TEST_PERIOD_MS)));
+	/* No tick missed while streaming */
+	HOST_TEST_CHECK(elapsed == g_ms);
+	exit(Host_Test_Result("Test_Telemetry"));
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	uint8 record;
+
+	Host_Test_Tick();
+	g_ms++;
+
+	/* The bytes sent by the UART during this millisecond */
+	if (!(UCSRB & (1 << UDRIE)))
+	{
+		g_uartCredit = 0;
+	}
+	g_uartCredit += F_CPU;
+	while ((g_uartCredit >= Test_ByteTime()) && (Host_Test_UartTransmit() == TRUE))
+	{
+		g_uartCredit -= Test_ByteTime();
+	}
+
+	if (g_ms <= TEST_LOAD_MS)
+	{
+		for (record = 0; record < TEST_LOAD_RECORDS; record++)
+		{
+			Telemetry_SendTime(0);
+			g_sends++;
+		}
+	}
+	else if ((UART_GetTxFree() == UART_TX_BUFFER_SIZE) && ((g_ms % TEST_PERIOD_MS) != 0))
+	{
+		/* The buffer is empty and no period record is coming after this sleep */
+		Test_Check();
+	}
+}
+
+int main(void)
+{
+	MCUCSR = (1 << PORF);
+	Host_SetSleepHook(Test_Step);
+	Host_ApplicationMain();
+	return 1;
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,100 @@
+/*******************************************************************************************************************
+ * File Name: Test_TimeSnapshot.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Tear-Free Time Snapshot (StopWatch_GetTime()) (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * The Timer1 tick is a SIGALRM handler calling StopWatch_Tick(): it interrupts StopWatch_GetTime() at any
+ * instruction, like the ISR. Main reads the time of a channel set one minute before the end of the day as fast as
+ * it can while the interrupts stay enabled, until 70000 ticks (every carry up to the day wrap) have been counted.
+ * Every tick adds exactly one millisecond, so a copy must be a valid time equal to the start time plus the ticks
+ * counted at some moment of the read: between the tick count before and after StopWatch_GetTime(). A torn copy
+ * (e.g. 23:59:59 with the minutes already incremented) is outside this range.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <stdio.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "SevenSegment.h"
+#include "StopWatch.h"
+
+#define TEST_TICKS                     70000UL
+#define TEST_DAY_MS                    86400000L
+#define TEST_START_MS                  ((((23L * 60L) + 59L) * 60L) * 1000L)
+
+static volatile uint32 g_ticks = 0;
+
+/* The "ISR" of the Timer1 tick */
+static void Test_Tick(int signal)
+{
+	(void)signal;
+	StopWatch_Tick();
+	g_ticks++;
+}
+
+int main(void)
+{
+	StopWatch_TimeType start = {23, 59, 0, 0};
+	StopWatch_TimeType time;
+	struct itimerval period = {{0, 20}, {0, 20}};
+	struct itimerval stop = {{0, 0}, {0, 0}};
+	uint32 reads = 0;
+	uint32 invalid = 0;
+	uint32 torn = 0;
+	uint32 before;
+	uint32 after;
+	long elapsed;
+
+	Host_Reset();
+	SevenSegment_Multiplex_Init();
+	StopWatch_Init(StopWatch_HH_MM_SS);
+	HOST_TEST_CHECK(StopWatch_SetTime(0, &start) == TRUE);
+	sei();
+
+	signal(SIGALRM, Test_Tick);
+	setitimer(ITIMER_REAL, &period, NULL);
+	while (g_ticks < TEST_TICKS)
+	{
+		before = g_ticks;
+		StopWatch_GetTime(0, &time);
+		after = g_ticks;
+		reads++;
+		if ((time.hours > 23) || (time.minutes > 59) || (time.seconds > 59) || (time.milliseconds > 999))
+		{
+			invalid++;
+			continue;
+		}
+		/* Milliseconds since the start time (the day wraps at 24:00:00.000) */
+		elapsed = ((((((long)time.hours * 60L) + time.minutes) * 60L) + time.seconds) * 1000L) + time.milliseconds;
+		elapsed = (elapsed >= TEST_START_MS) ? (elapsed - TEST_START_MS) : (elapsed + TEST_DAY_MS - TEST_START_MS);
+		if ((elapsed < (long)before) || (elapsed > (long)after))
+		{
+			torn++;
+			if (torn < 10)
+			{
+				printf("read %ld ms after the start between tick %lu and tick %lu\n", elapsed,
+				       (unsigned long)before, (unsigned long)after);
+			}
+		}
+	}
+	setitimer(ITIMER_REAL, &stop, NULL);
+	signal(SIGALRM, SIG_IGN);
+
+	/* 70000 ticks after 23:59:00.000 */
+	StopWatch_GetTime(0, &time);
+	printf("%lu reads during %lu ticks: %lu invalid, %lu torn, end %02u:%02u:%02u.%03u\n",
+	       (unsigned long)reads, (unsigned long)g_ticks, (unsigned long)invalid, (unsigned long)torn,
+	       time.hours, time.minutes, time.seconds, time.milliseconds);
+	HOST_TEST_CHECK(reads > (10UL * TEST_TICKS));
+	HOST_TEST_CHECK(invalid == 0);
+	HOST_TEST_CHECK(torn == 0);
+	HOST_TEST_CHECK((time.hours == 0) && (time.minutes == 0) && (time.seconds == 10) && (time.milliseconds == 0));
+
+	return Host_Test_Result("Test_TimeSnapshot");
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,67 @@
+/*******************************************************************************************************************
+ * File Name: Test_Timebase.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Timer1 Time Base Drift Compensation (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built by the Makefile for several F_CPU. The tick is configured as in the application, then TIMER1_COMPA_vect
+ * is fired for one hour of ticks while the timer counts of every tick (OCR1A + 1 while it runs) are added up.
+ * The error of the time base is printed in ppm with the drift accumulator (the counts of the real ticks) and
+ * without it (every tick TIMER1_TICK_COUNTS long), the compensated one must stay within one timer count.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <stdio.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "TIMER1.h"
+
+/* One hour of ticks */
+#define TEST_TICKS                     (3600UL * TIMER1_TICK_HZ)
+
+int main(void)
+{
+	Timer1_ConfigType timer1Config = {0, TIMER1_TICK_COMPARE_VALUE, TIMER1_TICK_PRESCALER, CTC_4};
+	/* Timer counts of one hour at the exact tick rate, the error is measured against it */
+	double ideal = ((double)F_CPU / (double)TIMER1_TICK_PRESCALER_VALUE) * ((double)TEST_TICKS / TIMER1_TICK_HZ);
+	uint64 counts = 0;
+	uint32 badCompare = 0;
+	uint32 tick;
+	double compensatedPpm;
+	double uncompensatedPpm;
+
+	Host_Reset();
+	Timer1_NonPWm_Mode_Init(&timer1Config);
+	sei();
+
+	for (tick = 0; tick < TEST_TICKS; tick++)
+	{
+		/* The tick which ends now was OCR1A + 1 counts long (set at the previous compare match) */
+		if ((OCR1A != TIMER1_TICK_COMPARE_VALUE) && (OCR1A != (TIMER1_TICK_COMPARE_VALUE + 1)))
+		{
+			badCompare++;
+		}
+		counts += (uint64)OCR1A + 1;
+		Host_Test_Tick();
+	}
+
+	compensatedPpm = (((double)counts - ideal) / ideal) * 1e6;
+	uncompensatedPpm = ((((double)TIMER1_TICK_COUNTS * TEST_TICKS) - ideal) / ideal) * 1e6;
+	printf("F_CPU %lu Hz, pre-scaler %lu, OCR1A %lu + %lu/%lu: %+.3f ppm without the drift accumulator, "
+	       "%+.3f ppm with it\n", (unsigned long)F_CPU, (unsigned long)TIMER1_TICK_PRESCALER_VALUE,
+	       (unsigned long)TIMER1_TICK_COMPARE_VALUE, (unsigned long)TIMER1_TICK_REMAINDER,
+	       (unsigned long)TIMER1_TICK_DIVISOR, uncompensatedPpm, compensatedPpm);
+
+	/* A single tick is the normal or the one count longer compare value */
+	HOST_TEST_CHECK(badCompare == 0);
+	/* After one hour the compensated time base is within one timer count of the exact one */
+	HOST_TEST_CHECK(((double)counts - ideal) <= 1.0);
+	HOST_TEST_CHECK((ideal - (double)counts) <= 1.0);
+	/* Without the accumulator every tick is short by the fraction TIMER1_TICK_REMAINDER / TIMER1_TICK_DIVISOR */
+	HOST_TEST_CHECK((TIMER1_TICK_REMAINDER == 0) ? (uncompensatedPpm == 0.0) : (uncompensatedPpm < -1.0));
+
+	return Host_Test_Result(TEST_NAME);
+}
+
+#endif /* __AVR__ */
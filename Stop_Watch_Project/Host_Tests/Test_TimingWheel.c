@@ -0,0 +1,208 @@
+/*******************************************************************************************************************
+ * File Name: Test_TimingWheel.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Timer1 Software Timers (Timing Wheel) Against a Reference List (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * For 3 million ticks the software timers are started (one-shot or periodic, periods from 0 to 65535 ticks,
+ * so every wheel level and the cascades are used) and cancelled at random. A plain list keeps the tick at which
+ * every timer is due: every call back must come exactly at that tick, and no timer due may be left behind.
+ * Every reference entry has its own call back, so the call back tells which timer expired.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "TIMER1.h"
+
+#define TEST_TICKS                     3000000UL
+
+#if (TIMER1_NUM_OF_SOFT_TIMERS != 8)
+#error "The test has one call back for each of the 8 software timers"
+#endif
+
+typedef struct
+{
+	boolean active;
+	Timer1_SoftTimerId id;
+	Timer1_SoftTimerType type;
+	uint16 period;
+	uint32 due;
+}Test_TimerType;
+
+/* The reference list: the timers in use and the tick at which they are due */
+static Test_TimerType g_timers[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint32 g_now = 0;
+static uint32 g_expired = 0;
+/* Call backs of the timers longer than 3 wheel levels (4096 ticks), they are cascaded from the top level */
+static uint32 g_longExpired = 0;
+static uint32 g_early = 0;
+static uint32 g_late = 0;
+static uint32 g_unexpected = 0;
+
+static void Test_Expired(uint8 entry)
+{
+	Test_TimerType * timer = &g_timers[entry];
+
+	g_expired++;
+	if (timer -> active == FALSE)
+	{
+		g_unexpected++;
+		return;
+	}
+	if (timer -> period >= (TIMER1_WHEEL_SLOTS * TIMER1_WHEEL_SLOTS * TIMER1_WHEEL_SLOTS))
+	{
+		g_longExpired++;
+	}
+	if (timer -> due > g_now)
+	{
+		g_early++;
+	}
+	else if (timer -> due < g_now)
+	{
+		g_late++;
+	}
+
+	if (timer -> type == Timer1_Periodic)
+	{
+		timer -> due = g_now + timer -> period;
+	}
+	else
+	{
+		timer -> active = FALSE;
+	}
+}
+
+#define TEST_CALL_BACK(entry)          static void Test_CallBack##entry(void) { Test_Expired(entry); }
+TEST_CALL_BACK(0) TEST_CALL_BACK(1) TEST_CALL_BACK(2) TEST_CALL_BACK(3)
+TEST_CALL_BACK(4) TEST_CALL_BACK(5) TEST_CALL_BACK(6) TEST_CALL_BACK(7)
+
+static void (* const g_callBacks[TIMER1_NUM_OF_SOFT_TIMERS])(void) =
+{
+	Test_CallBack0, Test_CallBack1, Test_CallBack2, Test_CallBack3,
+	Test_CallBack4, Test_CallBack5, Test_CallBack6, Test_CallBack7
+};
+
+/* Mostly short periods (the lower levels), some long ones up to the 16-bit maximum, sometimes 0 (one tick) */
+static uint16 Test_RandomPeriod(void)
+{
+	switch (rand() % 8)
+	{
+	case 0:
+		return 0;
+	case 1:
+	case 2:
+		return (uint16)(rand() % 65536);
+	case 3:
+	case 4:
+		return (uint16)(1 + (rand() % 20));
+	default:
+		return (uint16)(1 + (rand() % 3000));
+	}
+}
+
+int main(void)
+{
+	Timer1_ConfigType timer1Config = {0, TIMER1_TICK_COMPARE_VALUE, TIMER1_TICK_PRESCALER, CTC_4};
+	uint32 starts = 0;
+	uint32 cancels = 0;
+	uint32 badStarts = 0;
+	uint32 missed = 0;
+	uint8 entry;
+	uint8 free;
+	int action;
+
+	Host_Reset();
+	Timer1_NonPWm_Mode_Init(&timer1Config);
+	sei();
+	srand(12);
+
+	for (g_now = 0; g_now < TEST_TICKS; )
+	{
+		action = rand() % 200;
+		if (action < 3)
+		{
+			/* Start a timer in a free reference entry, the driver refuses it only if all the timers are in use */
+			free = TIMER1_NUM_OF_SOFT_TIMERS;
+			for (entry = 0; entry < TIMER1_NUM_OF_SOFT_TIMERS; entry++)
+			{
+				if (g_timers[entry].active == FALSE)
+				{
+					free = entry;
+					break;
+				}
+			}
+			if (free == TIMER1_NUM_OF_SOFT_TIMERS)
+			{
+				if (Timer1_SoftTimer_Start(1, Timer1_OneShot, g_callBacks[0]) != TIMER1_INVALID_SOFT_TIMER)
+				{
+					badStarts++;
+				}
+			}
+			else
+			{
+				g_timers[free].period = Test_RandomPeriod();
+				g_timers[free].type = (rand() % 2) ? Timer1_Periodic : Timer1_OneShot;
+				g_timers[free].id = Timer1_SoftTimer_Start(g_timers[free].period, g_timers[free].type, g_callBacks[free]);
+				if (g_timers[free].id == TIMER1_INVALID_SOFT_TIMER)
+				{
+					badStarts++;
+				}
+				else
+				{
+					if (g_timers[free].period == 0)
+					{
+						g_timers[free].period = 1;
+					}
+					g_timers[free].due = g_now + g_timers[free].period;
+					g_timers[free].active = TRUE;
+					starts++;
+				}
+			}
+		}
+		else if (action < 5)
+		{
+			/* The longer the period the less likely the cancel, so the long timers expire a few times too */
+			entry = (uint8)(rand() % TIMER1_NUM_OF_SOFT_TIMERS);
+			if ((g_timers[entry].active == TRUE) && ((rand() % ((g_timers[entry].period / 400) + 1)) == 0))
+			{
+				Timer1_SoftTimer_Cancel(g_timers[entry].id);
+				g_timers[entry].active = FALSE;
+				cancels++;
+			}
+		}
+
+		g_now++;
+		Host_Test_Tick();
+
+		/* Every timer due at this tick has been called back (a late one would still be due) */
+		for (entry = 0; entry < TIMER1_NUM_OF_SOFT_TIMERS; entry++)
+		{
+			if ((g_timers[entry].active == TRUE) && (g_timers[entry].due <= g_now))
+			{
+				missed++;
+				g_timers[entry].active = FALSE;
+			}
+		}
+	}
+
+	printf("%lu ticks: %lu timers started, %lu cancelled, %lu call backs (%lu of the long timers)\n",
+	       (unsigned long)TEST_TICKS, (unsigned long)starts, (unsigned long)cancels, (unsigned long)g_expired,
+	       (unsigned long)g_longExpired);
+
+	HOST_TEST_CHECK(starts > 1000);
+	HOST_TEST_CHECK(g_expired > 10000);
+	HOST_TEST_CHECK(g_longExpired > 100);
+	HOST_TEST_CHECK(badStarts == 0);
+	HOST_TEST_CHECK(g_early == 0);
+	HOST_TEST_CHECK(g_late == 0);
+	HOST_TEST_CHECK(g_unexpected == 0);
+	HOST_TEST_CHECK(missed == 0);
+
+	return Host_Test_Result("Test_TimingWheel");
+}
+
+#endif /* __AVR__ */
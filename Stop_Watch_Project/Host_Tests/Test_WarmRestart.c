@@ -0,0 +1,204 @@
+/*******************************************************************************************************************
+ * File Name: Test_WarmRestart.c
+ * Date: 16/10/2026
+ * Driver: Host Test of the Warm Restart from the .noinit RAM after a Watchdog Reset (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built with STOPWATCH_NOINIT = the "host_noinit" section: the state of the stop-watch is one block of memory,
+ * copied out of the application at the "reset" and into the next run of the application before its main().
+ * Every run of the application is a child process (fork()), so it starts with the static variables of a reset;
+ * the children report what they saw in shared memory. The first run starts at power-on with random .noinit RAM,
+ * switches to the SS.mmm display at 5 s and is reset by the watchdog 0.7 ms after the tick of 5.321 s. After the
+ * watchdog reset the time must continue from 5.321 s at once (the lost time is the part of the millisecond),
+ * after a power-on reset it starts from zero. Every byte of the kept state is then corrupted in turn (one bit):
+ * the restart must either start from zero or continue with the right time, never with a wrong one.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "StopWatch.h"
+#include "TIMER1.h"
+
+/* The stop-watch state (see STOPWATCH_NOINIT in the Makefile) */
+extern uint8 __start_host_noinit[];
+extern uint8 __stop_host_noinit[];
+
+#define NOINIT_SIZE                    ((uint32)(__stop_host_noinit - __start_host_noinit))
+#define TEST_NOINIT_MAX                1024
+
+/* The watchdog reset comes during the millisecond after this tick */
+#define TEST_RESET_MS                  5321UL
+#define TEST_MODE_MS                   5000UL
+#define TEST_RUN_MS                    10UL
+
+/* What a run of the application does */
+#define TEST_FIRST_RUN                 0
+#define TEST_RESTART                   1
+
+typedef struct {
+uint8 noinit[TEST_NOINIT_MAX];
+uint32 first;
+uint32 after;
+boolean running;
+StopWatch_DisplayMode mode;
+char display[7];
+} Test_SharedType;
+
+static Test_SharedType * g_shared;
+static uint8 g_run;
+static uint32 g_ms = 0;
+
+static uint32 Test_TimeMs(void)
+{
+	StopWatch_TimeType time;
+
+	StopWatch_GetTime(0, &time);
+	return ((((((uint32)time.hours * 60UL) + time.minutes) * 60UL) + time.seconds) * 1000UL) + time.milliseconds;
+}
+
+/* Sleep hook: one millisecond passes every time the application sleeps */
+static void Test_Step(void)
+{
+	if (g_ms == 0)
+	{
+		/* The time right after main() is done with the initialization */
+		g_shared -> first = Test_TimeMs();
+	}
+
+	Host_Test_Tick();
+	g_ms++;
+
+	if (g_run == TEST_FIRST_RUN)
+	{
+		if (g_ms == TEST_MODE_MS)
+		{
+			StopWatch_SetDisplayMode(StopWatch_SS_mmm);
+		}
+		else if (g_ms == TEST_RESET_MS)
+		{
+			/* The watchdog reset, 70% into the next millisecond */
+			TCNT1 = (uint16)((TIMER1_TICK_COMPARE_VALUE * 7UL) / 10UL);
+			memcpy(g_shared -> noinit, __start_host_noinit, NOINIT_SIZE);
+			exit(0);
+		}
+	}
+	else if (g_ms == TEST_RUN_MS)
+	{
+		g_shared -> after = Test_TimeMs();
+		g_shared -> running = StopWatch_IsRunning(0);
+		g_shared -> mode = StopWatch_GetDisplayMode();
+		Host_Test_ReadDisplay(g_shared -> display);
+		exit(0);
+	}
+}
+
+/* One run of the application after a reset with the required flags, from the .noinit RAM kept in shared memory */
+static boolean Test_Run(uint8 run, uint8 resetFlags)
+{
+	pid_t child;
+	int status;
+
+	g_shared -> first = 0xFFFFFFFFUL;
+	g_shared -> after = 0xFFFFFFFFUL;
+	fflush(stdout);
+	child = fork();
+	if (child == 0)
+	{
+		g_run = run;
+		memcpy(__start_host_noinit, g_shared -> noinit, NOINIT_SIZE);
+		MCUCSR = resetFlags;
+		Host_SetSleepHook(Test_Step);
+		Host_ApplicationMain();
+		exit(1);
+	}
+	return ((child > 0) && (waitpid(child, &status, 0) == child) && WIFEXITED(status) &&
+	        (WEXITSTATUS(status) == 0)) ? TRUE : FALSE;
+}
+
+int main(void)
+{
+	uint8 kept[TEST_NOINIT_MAX];
+	uint32 byte;
+	uint32 detected = 0;
+	uint32 undetected = 0;
+	uint32 wrong = 0;
+
+	g_shared = mmap(NULL, sizeof(Test_SharedType), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	HOST_TEST_CHECK(g_shared != MAP_FAILED);
+	HOST_TEST_CHECK(NOINIT_SIZE <= TEST_NOINIT_MAX);
+	if ((g_shared == MAP_FAILED) || (NOINIT_SIZE > TEST_NOINIT_MAX))
+	{
+		return Host_Test_Result("Test_WarmRestart");
+	}
+
+	/* Power-on: the .noinit RAM holds anything */
+	srand(22);
+	for (byte = 0; byte < NOINIT_SIZE; byte++)
+	{
+		g_shared -> noinit[byte] = (uint8)rand();
+	}
+	HOST_TEST_CHECK(Test_Run(TEST_FIRST_RUN, (1 << PORF)) == TRUE);
+	HOST_TEST_CHECK(g_shared -> first == 0);
+	memcpy(kept, g_shared -> noinit, NOINIT_SIZE);
+
+	/* Watchdog reset: the time, the running state and the display mode are back before the first tick */
+	HOST_TEST_CHECK(Test_Run(TEST_RESTART, (1 << WDRF)) == TRUE);
+	printf("watchdog reset at %lu ms: %lu ms at the restart, %lu ms %lu ticks later, display %s\n",
+	       (unsigned long)TEST_RESET_MS, (unsigned long)g_shared -> first, (unsigned long)g_shared -> after,
+	       (unsigned long)TEST_RUN_MS, g_shared -> display);
+	HOST_TEST_CHECK(g_shared -> first == TEST_RESET_MS);
+	HOST_TEST_CHECK(g_shared -> after == (TEST_RESET_MS + TEST_RUN_MS));
+	HOST_TEST_CHECK(g_shared -> running == TRUE);
+	HOST_TEST_CHECK(g_shared -> mode == StopWatch_SS_mmm);
+	HOST_TEST_CHECK(strcmp(g_shared -> display, "005331") == 0);
+
+	/* Brown-out and external resets restart the same way, a power-on reset starts from zero */
+	memcpy(g_shared -> noinit, kept, NOINIT_SIZE);
+	HOST_TEST_CHECK(Test_Run(TEST_RESTART, (1 << BORF)) == TRUE);
+	HOST_TEST_CHECK(g_shared -> after == (TEST_RESET_MS + TEST_RUN_MS));
+	memcpy(g_shared -> noinit, kept, NOINIT_SIZE);
+	HOST_TEST_CHECK(Test_Run(TEST_RESTART, (1 << EXTRF)) == TRUE);
+	HOST_TEST_CHECK(g_shared -> after == (TEST_RESET_MS + TEST_RUN_MS));
+	memcpy(g_shared -> noinit, kept, NOINIT_SIZE);
+	HOST_TEST_CHECK(Test_Run(TEST_RESTART, (1 << PORF)) == TRUE);
+	HOST_TEST_CHECK((g_shared -> after == TEST_RUN_MS) && (g_shared -> mode == StopWatch_HH_MM_SS));
+
+	/* One corrupted bit in each byte: restart from zero (detected) or with the right time (a padding byte) */
+	for (byte = 0; byte < NOINIT_SIZE; byte++)
+	{
+		memcpy(g_shared -> noinit, kept, NOINIT_SIZE);
+		g_shared -> noinit[byte] ^= 0x01;
+		if (Test_Run(TEST_RESTART, (1 << WDRF)) == FALSE)
+		{
+			wrong++;
+		}
+		else if (g_shared -> after == TEST_RUN_MS)
+		{
+			detected++;
+		}
+		else if (g_shared -> after == (TEST_RESET_MS + TEST_RUN_MS))
+		{
+			undetected++;
+		}
+		else
+		{
+			wrong++;
+			printf("byte %lu corrupted: %lu ms\n", (unsigned long)byte, (unsigned long)g_shared -> after);
+		}
+	}
+	printf("%lu bytes of .noinit state: %lu corruptions detected, %lu not (padding bytes), %lu wrong restarts\n",
+	       (unsigned long)NOINIT_SIZE, (unsigned long)detected, (unsigned long)undetected, (unsigned long)wrong);
+	HOST_TEST_CHECK(wrong == 0);
+	HOST_TEST_CHECK(detected > 0);
+
+	return Host_Test_Result("Test_WarmRestart");
+}
+
+#endif /* __AVR__ */
@@ -0,0 +1,247 @@
+/*******************************************************************************************************************
+ * File Name: Test_Watchdog.c
+ * Date: 17/10/2026
+ * Driver: Host Test of the Watchdog Supervisor and its Fault Record (Host Build Only)
+ * Author: Youssef Zaki
+ *
+ * Built with WATCHDOG_NOINIT = the "host_noinit" section. Every run of the supervisor is a child process (fork()),
+ * so it starts with the static variables of a reset and the .noinit RAM kept in shared memory, as Test_WarmRestart.
+ * The first run starts at power-on with random .noinit RAM: the watchdog is reset while the tasks check in, also
+ * when a task is no longer supervised (deadline 0), and no more once a task missed its deadline, the fault record
+ * names it (the first run makes its own checks, its result is its exit status). The record is still there after
+ * the watchdog reset with the reset counted, its last task is cleared after another reset. Every byte of the record
+ * is then corrupted in turn (one bit): the checksum must clear it, never keep a wrong one.
+ ******************************************************************************************************************/
+#ifndef __AVR__
+
+#include "Host_Test.h"
+#include <avr/io.h>
+#include <avr/wdt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "Watchdog.h"
+
+/* The fault record (see WATCHDOG_NOINIT in the Makefile) */
+extern uint8 __start_host_noinit[];
+extern uint8 __stop_host_noinit[];
+
+#define NOINIT_SIZE                    ((uint32)(__stop_host_noinit - __start_host_noinit))
+#define TEST_NOINIT_MAX                64
+
+#define TEST_MAIN_TASK                 0
+#define TEST_DISPLAY_TASK              1
+#define TEST_UART_TASK                 2
+
+#define TEST_UART_DEADLINE             2
+
+typedef struct {
+uint8 noinit[TEST_NOINIT_MAX];
+Watchdog_FaultType faults;
+uint32 resets;
+} Test_SharedType;
+
+static Test_SharedType * g_shared;
+
+/* Periods of the supervisor with the required tasks checking in, the function will return the watchdog resets */
+static uint32 Test_Periods(uint8 periods, boolean main, boolean display, boolean uart)
+{
+	uint32 resets = Host_GetWatchdogResets();
+
+	while (periods--)
+	{
+		if (main == TRUE)
+		{
+			Watchdog_CheckIn(TEST_MAIN_TASK);
+		}
+		if (display == TRUE)
+		{
+			Watchdog_CheckIn(TEST_DISPLAY_TASK);
+		}
+		if (uart == TRUE)
+		{
+			Watchdog_CheckIn(TEST_UART_TASK);
+		}
+		Watchdog_Period();
+	}
+	return Host_GetWatchdogResets() - resets;
+}
+
+/* Power-on: the tasks of the application supervised, then the UART task misses its deadline */
+static void Test_FirstRun(void)
+{
+	Watchdog_FaultType faults;
+	Watchdog_TaskId task;
+
+	Watchdog_Init(WDTO_500MS, FALSE);
+	Watchdog_GetFaults(&faults);
+	HOST_TEST_CHECK((faults.last_task == WATCHDOG_NO_TASK) && (faults.resets == 0));
+	for (task = 0; task < WATCHDOG_NUM_OF_TASKS; task++)
+	{
+		HOST_TEST_CHECK(faults.misses[task] == 0);
+	}
+	HOST_TEST_CHECK(WDTCR & (1 << WDE));
+
+	Watchdog_Supervise(TEST_MAIN_TASK, 3);
+	Watchdog_Supervise(TEST_DISPLAY_TASK, 1);
+	Watchdog_Supervise(TEST_UART_TASK, TEST_UART_DEADLINE);
+	HOST_TEST_CHECK(Test_Periods(10, TRUE, TRUE, TRUE) == 10);
+	HOST_TEST_CHECK(Watchdog_GetMaxSilence(TEST_DISPLAY_TASK) == 0);
+
+	/* Deadline 0: the display task is silent, the watchdog is still reset */
+	Watchdog_Supervise(TEST_DISPLAY_TASK, 0);
+	HOST_TEST_CHECK(Test_Periods(10, TRUE, FALSE, TRUE) == 10);
+	HOST_TEST_CHECK(Watchdog_GetMaxSilence(TEST_DISPLAY_TASK) == 0);
+
+	/* The main task is late within its deadline, the UART task misses its deadline at the second period */
+	HOST_TEST_CHECK(Test_Periods(1, FALSE, FALSE, FALSE) == 1);
+	HOST_TEST_CHECK(Test_Periods(1, FALSE, FALSE, FALSE) == 0);
+	HOST_TEST_CHECK(Test_Periods(5, TRUE, TRUE, TRUE) == 0);
+	HOST_TEST_CHECK(Watchdog_GetMaxSilence(TEST_UART_TASK) == TEST_UART_DEADLINE);
+
+	Watchdog_GetFaults(&faults);
+	HOST_TEST_CHECK((faults.last_task == TEST_UART_TASK) && (faults.resets == 0));
+	HOST_TEST_CHECK(faults.misses[TEST_MAIN_TASK] == 0);
+	HOST_TEST_CHECK(faults.misses[TEST_DISPLAY_TASK] == 0);
+	HOST_TEST_CHECK(faults.misses[TEST_UART_TASK] == 1);
+}
+
+/* The first run of the supervisor, from the random .noinit RAM in shared memory */
+static boolean Test_PowerOn(void)
+{
+	pid_t child;
+	int status;
+
+	fflush(stdout);
+	child = fork();
+	if (child == 0)
+	{
+		memcpy(__start_host_noinit, g_shared -> noinit, NOINIT_SIZE);
+		Test_FirstRun();
+		memcpy(g_shared -> noinit, __start_host_noinit, NOINIT_SIZE);
+		exit(Host_Test_Result("Test_Watchdog power-on run"));
+	}
+	return ((child > 0) && (waitpid(child, &status, 0) == child) && WIFEXITED(status) &&
+	        (WEXITSTATUS(status) == 0)) ? TRUE : FALSE;
+}
+
+/*
+ * One restart of the supervisor from the .noinit RAM kept in shared memory (and back): the record after Watchdog_Init()
+ * and the watchdog resets of 3 periods with no task checking in (no task is supervised until Watchdog_Supervise()).
+ */
+static boolean Test_Restart(boolean watchdogReset)
+{
+	pid_t child;
+	int status;
+
+	memset(&g_shared -> faults, 0xAA, sizeof(g_shared -> faults));
+	g_shared -> resets = 0;
+	fflush(stdout);
+	child = fork();
+	if (child == 0)
+	{
+		memcpy(__start_host_noinit, g_shared -> noinit, NOINIT_SIZE);
+		Watchdog_Init(WDTO_500MS, watchdogReset);
+		Watchdog_GetFaults(&g_shared -> faults);
+		g_shared -> resets = Test_Periods(3, FALSE, FALSE, FALSE);
+		memcpy(g_shared -> noinit, __start_host_noinit, NOINIT_SIZE);
+		exit(0);
+	}
+	return ((child > 0) && (waitpid(child, &status, 0) == child) && WIFEXITED(status) &&
+	        (WEXITSTATUS(status) == 0) && (g_shared -> resets == 3)) ? TRUE : FALSE;
+}
+
+/* The record after a watchdog reset which found it corrupted: cleared, with this reset counted */
+static boolean Test_IsCleared(const Watchdog_FaultType * faults)
+{
+	Watchdog_TaskId task;
+
+	if ((faults -> last_task != WATCHDOG_NO_TASK) || (faults -> resets != 1))
+	{
+		return FALSE;
+	}
+	for (task = 0; task < WATCHDOG_NUM_OF_TASKS; task++)
+	{
+		if (faults -> misses[task] != 0)
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+int main(void)
+{
+	uint8 kept[TEST_NOINIT_MAX];
+	Watchdog_FaultType expected;
+	uint32 byte;
+	uint32 detected = 0;
+	uint32 undetected = 0;
+	uint32 wrong = 0;
+
+	g_shared = mmap(NULL, sizeof(Test_SharedType), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	HOST_TEST_CHECK(g_shared != MAP_FAILED);
+	HOST_TEST_CHECK(NOINIT_SIZE <= TEST_NOINIT_MAX);
+	if ((g_shared == MAP_FAILED) || (NOINIT_SIZE > TEST_NOINIT_MAX))
+	{
+		return Host_Test_Result("Test_Watchdog");
+	}
+
+	/* Power-on: the .noinit RAM holds anything */
+	srand(23);
+	for (byte = 0; byte < NOINIT_SIZE; byte++)
+	{
+		g_shared -> noinit[byte] = (uint8)rand();
+	}
+	HOST_TEST_CHECK(Test_PowerOn() == TRUE);
+	memcpy(kept, g_shared -> noinit, NOINIT_SIZE);
+
+	/* Watchdog reset: the task which missed its deadline is still named, the reset is counted */
+	HOST_TEST_CHECK(Test_Restart(TRUE) == TRUE);
+	expected = g_shared -> faults;
+	HOST_TEST_CHECK((expected.last_task == TEST_UART_TASK) && (expected.resets == 1));
+	HOST_TEST_CHECK(expected.misses[TEST_UART_TASK] == 1);
+	HOST_TEST_CHECK(Test_IsCleared(&expected) == FALSE);
+
+	/* Then a reset which is not the watchdog (e.g. external): the counters are kept, the last task is cleared */
+	HOST_TEST_CHECK(Test_Restart(FALSE) == TRUE);
+	HOST_TEST_CHECK((g_shared -> faults.last_task == WATCHDOG_NO_TASK) && (g_shared -> faults.resets == 1));
+	HOST_TEST_CHECK(g_shared -> faults.misses[TEST_UART_TASK] == 1);
+
+	/* One corrupted bit in each byte: the record is cleared (detected) or the same (a padding byte) */
+	for (byte = 0; byte < NOINIT_SIZE; byte++)
+	{
+		memcpy(g_shared -> noinit, kept, NOINIT_SIZE);
+		g_shared -> noinit[byte] ^= 0x01;
+		if (Test_Restart(TRUE) == FALSE)
+		{
+			wrong++;
+		}
+		else if (Test_IsCleared(&g_shared -> faults) == TRUE)
+		{
+			detected++;
+		}
+		else if (memcmp(&g_shared -> faults, &expected, sizeof(expected)) == 0)
+		{
+			undetected++;
+		}
+		else
+		{
+			wrong++;
+			printf("byte %lu corrupted: last task %u, %u resets\n", (unsigned long)byte,
+			       g_shared -> faults.last_task, g_shared -> faults.resets);
+		}
+	}
+	printf("%lu bytes of .noinit fault record: %lu corruptions detected, %lu not (padding bytes), %lu wrong records\n",
+	       (unsigned long)NOINIT_SIZE, (unsigned long)detected, (unsigned long)undetected, (unsigned long)wrong);
+	HOST_TEST_CHECK(wrong == 0);
+	/* The record, its checksum and its marker */
+	HOST_TEST_CHECK(detected >= (sizeof(Watchdog_FaultType) + 1 + 2));
+
+	return Host_Test_Result("Test_Watchdog");
+}
+
+#endif /* __AVR__ */
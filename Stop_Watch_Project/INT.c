@@ -16,11 +16,12 @@
 /* Description:
  * 1. Configure PIN 2 in PORTD to be input pin.
  * 2. Configure MCUCR Register bits 0 & 1 (ISC01 & ISC00) according to level or edges (rising or falling).
- * 3. Configure GICR Register bit no.6 (INT0) to enable the external INT0 Request..
+ * 3. Clear a pending INT0 request (INTF0 in GIFR Register) left from a bounce while it was disabled.
+ * 4. Configure GICR Register bit no.6 (INT0) to enable the external INT0 Request..
  */
 void INT0_Init(INT0_MCUCR_Config INT0_Config)
 {
-	CLEAR_BIT(DDRD, PIN2_ID);
+	GPIO_SetupPinDirection_Fast(PORTD_ID, PIN2_ID, INPUT_PIN);
 
 	switch (INT0_Config)
 	{
@@ -44,17 +45,20 @@ void INT0_Init(INT0_MCUCR_Config INT0_Config)
 		SET_BIT(MCUCR, ISC00);
 		break;
 	}
+	/* The flag is cleared by writing one to it */
+	GIFR = (1 << INTF0);
 	SET_BIT(GICR, INT0);
 }
 
 /* Description:
  * 1. Configure PIN 3 in PORTD to be input pin.
  * 2. Configure MCUCR Register bits 2 & 3 (ISC11 & ISC10) according to level or edges (rising or falling).
- * 3. Configure GICR Register bit no.7 (INT1) to enable the external INT1 Request.
+ * 3. Clear a pending INT1 request (INTF1 in GIFR Register) left from a bounce while it was disabled.
+ * 4. Configure GICR Register bit no.7 (INT1) to enable the external INT1 Request.
  */
 void INT1_Init(INT1_MCUCR_Config INT1_Config)
 {
-	CLEAR_BIT(DDRD, PIN3_ID);
+	GPIO_SetupPinDirection_Fast(PORTD_ID, PIN3_ID, INPUT_PIN);
 
 	switch (INT1_Config)
 	{
@@ -78,6 +82,7 @@ void INT1_Init(INT1_MCUCR_Config INT1_Config)
 		SET_BIT(MCUCR, ISC10);
 		break;
 	}
+	GIFR = (1 << INTF1);
 	SET_BIT(GICR, INT1);
 }
 
@@ -86,16 +91,18 @@ void INT1_Init(INT1_MCUCR_Config INT1_Config)
  * 1. Configure Pin2 at PORTB to be input pin.
  * 2. It is recommended to first disable INT2 by clearing its Interrupt Enable bit in the GICR Register.
  * 3. Choose if the falling edge or rising edge activates the interrupt through ISC2 pin in MCUCSR Register.
- * 4. Configure GICR Register bit no.6 (INT2) to enable the external INT2 Request.
+ * 4. Clear the INT2 request (INTF2 in GIFR Register) which can be set when ISC2 is changed or by a bounce.
+ * 5. Configure GICR Register bit no.5 (INT2) to enable the external INT2 Request.
  */
 void INT2_Init(INT2_MCUCSR_Config INT2_Config)
 {
-	CLEAR_BIT(DDRB, PIN2_ID);
+	GPIO_SetupPinDirection_Fast(PORTB_ID, PIN2_ID, INPUT_PIN);
 
 	CLEAR_BIT(GICR, INT2);
 
 	MCUCSR = (MCUCSR & 0xBF) | (INT2_Config << ISC2);
 
+	GIFR = (1 << INTF2);
 	SET_BIT(GICR, INT2);
 }
 
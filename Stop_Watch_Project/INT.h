@@ -38,14 +38,16 @@ typedef enum
 /* Description:
  * 1. Configure PIN 2 in PORTD to be input pin.
  * 2. Configure MCUCR Register bits 0 & 1 (ISC01 & ISC00) according to level or edges (rising or falling).
- * 3. Configure GICR Register bit no.6 (INT0) to enable the external INT0 Request.
+ * 3. Clear a pending INT0 request (INTF0 in GIFR Register) left from a bounce while it was disabled.
+ * 4. Configure GICR Register bit no.6 (INT0) to enable the external INT0 Request.
  */
 void INT0_Init(INT0_MCUCR_Config INT0_Config);
 
 /* Description:
  * 1. Configure PIN 3 in PORTD to be input pin.
  * 2. Configure MCUCR Register bits 2 & 3 (ISC11 & ISC10) according to level or edges (rising or falling).
- * 3. Configure GICR Register bit no.7 (INT1) to enable the external INT1 Request.
+ * 3. Clear a pending INT1 request (INTF1 in GIFR Register) left from a bounce while it was disabled.
+ * 4. Configure GICR Register bit no.7 (INT1) to enable the external INT1 Request.
  */
 void INT1_Init(INT1_MCUCR_Config INT1_Config);
 
@@ -54,7 +56,8 @@ void INT1_Init(INT1_MCUCR_Config INT1_Config);
  * 1. Configure Pin2 at PORTB to be input pin.
  * 2. It is recommended to first disable INT2 by clearing its Interrupt Enable bit in the GICR Register.
  * 3. Choose if the falling edge or rising edge activates the interrupt through ISC2 pin in MCUCSR Register.
- * 4. Configure GICR Register bit no.6 (INT2) to enable the external INT2 Request.
+ * 4. Clear the INT2 request (INTF2 in GIFR Register) which can be set when ISC2 is changed or by a bounce.
+ * 5. Configure GICR Register bit no.5 (INT2) to enable the external INT2 Request.
  */
 void INT2_Init(INT2_MCUCSR_Config INT2_Config);
 
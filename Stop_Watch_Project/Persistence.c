@@ -0,0 +1,202 @@
+/*******************************************************************************************************************
+ * File Name: Persistence.c
+ * Date: 16/10/2026
+ * Driver: Stop-Watch State Persistence in a Wear-Leveled EEPROM Ring Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Persistence.h"
+#include "EEPROM.h"
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <stddef.h>
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* EEPROM bytes used by the ring (the whole EEPROM by default) */
+#ifndef PERSISTENCE_EEPROM_SIZE
+#define PERSISTENCE_EEPROM_SIZE                    (E2END + 1)
+#endif
+
+#define PERSISTENCE_NUM_OF_SLOTS                   (PERSISTENCE_EEPROM_SIZE / sizeof(Persistence_SlotType))
+
+/* Sequence number of an erased slot (the erased EEPROM reads 0xFF), never used for a saved state */
+#define PERSISTENCE_ERASED_SEQUENCE                0xFFFF
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/*
+ * One slot of the ring. The sequence number is written first and the checksum last,
+ * so a save interrupted by a power loss leaves a slot with a wrong checksum.
+ */
+typedef struct {
+uint16 sequence;
+Persistence_DataType data;
+uint8 crc;
+} Persistence_SlotType;
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* The ring in the EEPROM */
+static Persistence_SlotType g_slots[PERSISTENCE_NUM_OF_SLOTS] EEMEM;
+
+/* The slot being written (read by the EEPROM ISR until the save is complete) or read */
+static Persistence_SlotType g_image;
+
+static uint8 g_nextSlot = 0;
+static uint16 g_nextSequence = 0;
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * CRC-8 (polynomial 0x07, initial value 0xFF) of the slot up to its checksum byte,
+ * the initial value makes a slot of zeros (a cleared EEPROM) invalid.
+ */
+static uint8 Persistence_Crc(const Persistence_SlotType * slot)
+{
+	const uint8 * byte = (const uint8 *)slot;
+	uint8 length = offsetof(Persistence_SlotType, crc);
+	uint8 crc = 0xFF;
+	uint8 bit;
+
+	while (length != 0)
+	{
+		crc ^= *byte;
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x80) ? (uint8)((crc << 1) ^ 0x07) : (uint8)(crc << 1);
+		}
+		byte++;
+		length--;
+	}
+	return crc;
+}
+
+/*
+ * Description:
+ * The sequence number one save after (step = 1) or one save before (step = -1) the sequence number,
+ * the erased sequence number is skipped, so the saves go ... 0xFFFD, 0xFFFE, 0, 1 ...
+ */
+static uint16 Persistence_StepSequence(uint16 sequence, sint8 step)
+{
+	sequence = (uint16)(sequence + step);
+	if (sequence == PERSISTENCE_ERASED_SEQUENCE)
+	{
+		sequence = (uint16)(sequence + step);
+	}
+	return sequence;
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Find the newest valid saved state in the EEPROM ring and copy it to data (at boot, before any save):
+ * only the sequence numbers of the slots are read to find the newest one, then its checksum is checked
+ * (going back to the previous slot if the newest one was not completely written).
+ * The function will return FALSE if there is no valid saved state.
+ */
+boolean Persistence_Restore(Persistence_DataType * data)
+{
+	uint8 slot;
+	uint8 newestSlot = 0;
+	uint16 newestSequence = PERSISTENCE_ERASED_SEQUENCE;
+	uint16 sequence;
+	uint8 tries;
+
+	g_nextSlot = 0;
+	g_nextSequence = 0;
+
+	/* The newest sequence number, compared with the wrap around (serial number arithmetic) */
+	for (slot = 0; slot < PERSISTENCE_NUM_OF_SLOTS; slot++)
+	{
+		if (EEPROM_Read((const uint8 *)&g_slots[slot].sequence, (uint8 *)&sequence, sizeof(sequence)) == FALSE)
+		{
+			return FALSE;
+		}
+		if ((sequence != PERSISTENCE_ERASED_SEQUENCE) &&
+		    ((newestSequence == PERSISTENCE_ERASED_SEQUENCE) || ((sint16)(sequence - newestSequence) > 0)))
+		{
+			newestSlot = slot;
+			newestSequence = sequence;
+		}
+	}
+	if (newestSequence == PERSISTENCE_ERASED_SEQUENCE)
+	{
+		return FALSE;
+	}
+
+	/* The saves are written in the ring order, so the previous save is in the previous slot */
+	slot = newestSlot;
+	sequence = newestSequence;
+	for (tries = 0; tries < PERSISTENCE_NUM_OF_SLOTS; tries++)
+	{
+		EEPROM_Read((const uint8 *)&g_slots[slot], (uint8 *)&g_image, sizeof(Persistence_SlotType));
+		if (g_image.sequence != sequence)
+		{
+			/* Not the previous save of the ring (never written or from an older ring turn) */
+			break;
+		}
+		if (g_image.crc == Persistence_Crc(&g_image))
+		{
+			*data = g_image.data;
+			g_nextSlot = (slot + 1) % PERSISTENCE_NUM_OF_SLOTS;
+			g_nextSequence = Persistence_StepSequence(g_image.sequence, 1);
+			return TRUE;
+		}
+		slot = (slot == 0) ? (uint8)(PERSISTENCE_NUM_OF_SLOTS - 1) : (uint8)(slot - 1);
+		sequence = Persistence_StepSequence(sequence, -1);
+	}
+
+	/* Continue after the newest slot anyway, so the ring order is kept */
+	g_nextSlot = (newestSlot + 1) % PERSISTENCE_NUM_OF_SLOTS;
+	g_nextSequence = Persistence_StepSequence(newestSequence, 1);
+	return FALSE;
+}
+
+/*
+ * Description:
+ * Save the state in the next slot of the EEPROM ring (so every slot is written once every ring turn)
+ * without waiting, the EEPROM ready interrupt writes it in the background.
+ * The function will return FALSE if the previous save is not completely written yet (nothing is saved).
+ */
+boolean Persistence_Save(const Persistence_DataType * data)
+{
+	if (EEPROM_IsBusy() == TRUE)
+	{
+		return FALSE;
+	}
+
+	g_image.sequence = g_nextSequence;
+	g_image.data = *data;
+	g_image.crc = Persistence_Crc(&g_image);
+
+	if (EEPROM_Write((uint8 *)&g_slots[g_nextSlot], (const uint8 *)&g_image, sizeof(Persistence_SlotType)) == FALSE)
+	{
+		return FALSE;
+	}
+
+	g_nextSlot = (g_nextSlot + 1) % PERSISTENCE_NUM_OF_SLOTS;
+	g_nextSequence = Persistence_StepSequence(g_nextSequence, 1);
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the EEPROM ready ISR when a save is completely written.
+ */
+void Persistence_SetCallBack(void(*a_ptr)(void))
+{
+	EEPROM_SetCallBack(a_ptr);
+}
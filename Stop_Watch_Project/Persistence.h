@@ -0,0 +1,61 @@
+/*******************************************************************************************************************
+ * File Name: Persistence.h
+ * Date: 16/10/2026
+ * Driver: Stop-Watch State Persistence in a Wear-Leveled EEPROM Ring Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+#include "StopWatch.h"
+
+#ifndef PERSISTENCE_H_
+#define PERSISTENCE_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Number of the last laps of every channel kept in the saved state */
+#ifndef PERSISTENCE_NUM_OF_LAPS
+#define PERSISTENCE_NUM_OF_LAPS                    4
+#endif
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/* The saved state of the stop-watch */
+typedef struct {
+StopWatch_TimeType time[STOPWATCH_NUM_OF_CHANNELS];
+uint8 lap_count[STOPWATCH_NUM_OF_CHANNELS];    /* Laps captured since the last reset */
+StopWatch_TimeType laps[STOPWATCH_NUM_OF_CHANNELS][PERSISTENCE_NUM_OF_LAPS]; /* Lap n is at (n - 1) % NUM_OF_LAPS */
+} Persistence_DataType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Find the newest valid saved state in the EEPROM ring and copy it to data (at boot, before any save):
+ * only the sequence numbers of the slots are read to find the newest one, then its checksum is checked
+ * (going back to the previous slot if the newest one was not completely written).
+ * The function will return FALSE if there is no valid saved state.
+ */
+boolean Persistence_Restore(Persistence_DataType * data);
+
+/*
+ * Description:
+ * Save the state in the next slot of the EEPROM ring (so every slot is written once every ring turn)
+ * without waiting, the EEPROM ready interrupt writes it in the background.
+ * The function will return FALSE if the previous save is not completely written yet (nothing is saved).
+ */
+boolean Persistence_Save(const Persistence_DataType * data);
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the EEPROM ready ISR when a save is completely written.
+ */
+void Persistence_SetCallBack(void(*a_ptr)(void));
+
+#endif /* PERSISTENCE_H_ */
@@ -0,0 +1,193 @@
+/*******************************************************************************************************************
+ * File Name: Profiler.c
+ * Date: 16/10/2026
+ * Driver: Interrupt Latency and Duration Profiler Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Profiler.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#if (PROFILER_ENABLE == TRUE)
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* Statistics of every ID, the means are computed when they are read */
+static uint16 g_count[PROFILER_NUM_OF_IDS];
+static uint16 g_minLatency[PROFILER_NUM_OF_IDS];
+static uint16 g_maxLatency[PROFILER_NUM_OF_IDS];
+static uint32 g_sumLatency[PROFILER_NUM_OF_IDS];
+static uint16 g_minDuration[PROFILER_NUM_OF_IDS];
+static uint16 g_maxDuration[PROFILER_NUM_OF_IDS];
+static uint32 g_sumDuration[PROFILER_NUM_OF_IDS];
+
+/* Log of the last measurements (circular buffer, the oldest is overwritten when it is full) */
+static Profiler_RecordType g_log[PROFILER_LOG_SIZE];
+static uint8 g_logHead = 0;
+static uint8 g_logCount = 0;
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Clear the statistics and the log.
+ */
+void Profiler_Reset(void)
+{
+	uint8 sreg = SREG;
+	uint8 id;
+
+	cli();
+	for (id = 0; id < PROFILER_NUM_OF_IDS; id++)
+	{
+		g_count[id] = 0;
+		g_minLatency[id] = 0xFFFF;
+		g_maxLatency[id] = 0;
+		g_sumLatency[id] = 0;
+		g_minDuration[id] = 0xFFFF;
+		g_maxDuration[id] = 0;
+		g_sumDuration[id] = 0;
+	}
+	g_logHead = 0;
+	g_logCount = 0;
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Add a measurement to the statistics of the ID and to the log (the oldest measurement is overwritten).
+ * Can be called from the ISRs and from main().
+ */
+void Profiler_Record(uint8 id, uint16 latency, uint16 duration)
+{
+	uint8 sreg = SREG;
+	Profiler_RecordType * record;
+
+	if (id >= PROFILER_NUM_OF_IDS)
+	{
+		return;
+	}
+
+	cli();
+	if (g_count[id] == 0xFFFF)
+	{
+		/* Keep the means correct: the statistics stop when the counter is full */
+		SREG = sreg;
+		return;
+	}
+	if (g_count[id] == 0)
+	{
+		g_minLatency[id] = 0xFFFF;
+		g_minDuration[id] = 0xFFFF;
+	}
+	g_count[id]++;
+
+	if (latency < g_minLatency[id])
+	{
+		g_minLatency[id] = latency;
+	}
+	if (latency > g_maxLatency[id])
+	{
+		g_maxLatency[id] = latency;
+	}
+	g_sumLatency[id] += latency;
+
+	if (duration < g_minDuration[id])
+	{
+		g_minDuration[id] = duration;
+	}
+	if (duration > g_maxDuration[id])
+	{
+		g_maxDuration[id] = duration;
+	}
+	g_sumDuration[id] += duration;
+
+	record = &g_log[(g_logHead + g_logCount) & (PROFILER_LOG_SIZE - 1)];
+	record -> id = id;
+	record -> latency = latency;
+	record -> duration = duration;
+	if (g_logCount < PROFILER_LOG_SIZE)
+	{
+		g_logCount++;
+	}
+	else
+	{
+		g_logHead = (g_logHead + 1) & (PROFILER_LOG_SIZE - 1);
+	}
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Record an ISR from TCNT1 at its entry: TCNT1 now is the exit (one tick is added if the next tick started during
+ * the ISR), see PROFILER_ISR_ENTRY() and PROFILER_ISR_EXIT().
+ */
+void Profiler_RecordIsr(uint8 id, uint16 entryCount)
+{
+	uint16 exitCount = TCNT1;
+
+	if (exitCount < entryCount)
+	{
+		/* The next tick started during the ISR (TCNT1 counts to OCR1A in the CTC mode of the tick) */
+		exitCount += OCR1A + 1;
+	}
+	Profiler_Record(id, entryCount, exitCount - entryCount);
+}
+
+/*
+ * Description:
+ * Read the min/max/mean latency and duration of the ID,
+ * the function will return FALSE if the ID is not correct or was not measured yet.
+ */
+boolean Profiler_GetStats(uint8 id, Profiler_StatsType * stats)
+{
+	uint8 sreg = SREG;
+	boolean found = FALSE;
+
+	if ((id >= PROFILER_NUM_OF_IDS) || (stats == NULL_PTR))
+	{
+		return FALSE;
+	}
+
+	cli();
+	if (g_count[id] != 0)
+	{
+		stats -> count = g_count[id];
+		stats -> min_latency = g_minLatency[id];
+		stats -> max_latency = g_maxLatency[id];
+		stats -> mean_latency = (uint16)(g_sumLatency[id] / g_count[id]);
+		stats -> min_duration = g_minDuration[id];
+		stats -> max_duration = g_maxDuration[id];
+		stats -> mean_duration = (uint16)(g_sumDuration[id] / g_count[id]);
+		found = TRUE;
+	}
+	SREG = sreg;
+	return found;
+}
+
+/*
+ * Description:
+ * Take the oldest measurement from the log, the function will return FALSE if the log is empty.
+ */
+boolean Profiler_GetRecord(Profiler_RecordType * record)
+{
+	uint8 sreg = SREG;
+	boolean found = FALSE;
+
+	cli();
+	if (g_logCount != 0)
+	{
+		*record = g_log[g_logHead];
+		g_logHead = (g_logHead + 1) & (PROFILER_LOG_SIZE - 1);
+		g_logCount--;
+		found = TRUE;
+	}
+	SREG = sreg;
+	return found;
+}
+
+#endif /* PROFILER_ENABLE */
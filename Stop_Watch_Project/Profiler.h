@@ -0,0 +1,117 @@
+/*******************************************************************************************************************
+ * File Name: Profiler.h
+ * Date: 16/10/2026
+ * Driver: Interrupt Latency and Duration Profiler Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+#include "Scheduler.h"
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * Build flag of the profiling (e.g. -DPROFILER_ENABLE=TRUE): when FALSE nothing is measured
+ * and the interrupts and the scheduler are built exactly as without the profiler.
+ */
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE                            FALSE
+#endif
+
+/* Number of the last measurements kept in the log (a power of two) */
+#define PROFILER_LOG_SIZE                          16
+
+/*
+ * What is measured (all the times are in Timer1 counts):
+ * PROFILER_TIMER1_COMPA_ID: latency = TCNT1 at the ISR entry (the compare match clears TCNT1), duration = ISR time.
+ * PROFILER_INT0_ID .. PROFILER_USART_UDRE_ID: latency = TCNT1 at the ISR entry (where the ISR started in the tick,
+ *                              the request time is not known), duration = ISR time.
+ * PROFILER_FIRST_EVENT_ID + n: latency = from the ISR posting the scheduler event n (e.g. INT0 for the reset button)
+ *                              to the start of its handler, duration = handler time.
+ */
+#define PROFILER_TIMER1_COMPA_ID                   0
+#define PROFILER_INT0_ID                           1
+#define PROFILER_INT1_ID                           2
+#define PROFILER_INT2_ID                           3
+#define PROFILER_TIMER0_COMP_ID                    4
+#define PROFILER_USART_RXC_ID                      5
+#define PROFILER_USART_UDRE_ID                     6
+#define PROFILER_FIRST_EVENT_ID                    7
+#define PROFILER_NUM_OF_IDS                        (PROFILER_FIRST_EVENT_ID + SCHEDULER_NUM_OF_EVENTS)
+
+/*
+ * To be put at the start and at the end of an ISR (the file includes <avr/io.h>): TCNT1 at the entry and at the exit
+ * are recorded under the ID. Nothing is built when PROFILER_ENABLE is FALSE.
+ */
+#if (PROFILER_ENABLE == TRUE)
+#define PROFILER_ISR_ENTRY()                       uint16 profilerEntryCount = TCNT1
+#define PROFILER_ISR_EXIT(id)                      Profiler_RecordIsr((id), profilerEntryCount)
+#else
+#define PROFILER_ISR_ENTRY()
+#define PROFILER_ISR_EXIT(id)
+#endif
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/* One measurement of the log */
+typedef struct {
+uint8 id;
+uint16 latency;
+uint16 duration;
+} Profiler_RecordType;
+
+/* Statistics of one ID since the last Profiler_Reset() */
+typedef struct {
+uint16 count;
+uint16 min_latency;
+uint16 max_latency;
+uint16 mean_latency;
+uint16 min_duration;
+uint16 max_duration;
+uint16 mean_duration;
+} Profiler_StatsType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Clear the statistics and the log.
+ */
+void Profiler_Reset(void);
+
+/*
+ * Description:
+ * Add a measurement to the statistics of the ID and to the log (the oldest measurement is overwritten).
+ * Can be called from the ISRs and from main().
+ */
+void Profiler_Record(uint8 id, uint16 latency, uint16 duration);
+
+/*
+ * Description:
+ * Record an ISR from TCNT1 at its entry: TCNT1 now is the exit (one tick is added if the next tick started during
+ * the ISR), see PROFILER_ISR_ENTRY() and PROFILER_ISR_EXIT().
+ */
+void Profiler_RecordIsr(uint8 id, uint16 entryCount);
+
+/*
+ * Description:
+ * Read the min/max/mean latency and duration of the ID,
+ * the function will return FALSE if the ID is not correct or was not measured yet.
+ */
+boolean Profiler_GetStats(uint8 id, Profiler_StatsType * stats);
+
+/*
+ * Description:
+ * Take the oldest measurement from the log, the function will return FALSE if the log is empty.
+ */
+boolean Profiler_GetRecord(Profiler_RecordType * record);
+
+#endif /* PROFILER_H_ */
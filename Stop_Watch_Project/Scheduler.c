@@ -0,0 +1,271 @@
+/*******************************************************************************************************************
+ * File Name: Scheduler.c
+ * Date: 16/10/2026
+ * Driver: Event-Driven Run-To-Completion Scheduler Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Scheduler.h"
+#include "TIMER1.h"
+#include "Profiler.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#if ((SCHEDULER_QUEUE_SIZE & (SCHEDULER_QUEUE_SIZE - 1)) != 0) || (SCHEDULER_QUEUE_SIZE > 128)
+#error "SCHEDULER_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* Handler of every event */
+static void (*g_eventHandler[SCHEDULER_NUM_OF_EVENTS])(void);
+
+/*
+ * Events queue: single producer / single consumer circular buffer without locks.
+ * The ISRs do not nest, so all of them together are the only producer (they write g_queueTail only)
+ * and Scheduler_Run() is the only consumer (it writes g_queueHead only).
+ * Both indices are free running 8-bit counters (one byte is read and written atomically by the AVR),
+ * the slot is the index modulo SCHEDULER_QUEUE_SIZE and the number of waiting events is g_queueTail - g_queueHead.
+ * The record is completely written/read before the index is moved, the volatile accesses keep that order.
+ */
+static volatile Scheduler_EventRecordType g_eventQueue[SCHEDULER_QUEUE_SIZE];
+static volatile uint8 g_queueHead = 0;
+static volatile uint8 g_queueTail = 0;
+
+/* Record of the event being handled, read by the handler through Scheduler_GetEventTime() */
+static Scheduler_EventRecordType g_currentEvent;
+
+static volatile uint16 g_lostEvents = 0;
+
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE)
+static volatile uint32 g_busyTime = 0;
+#endif
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Take the next event record from the queue (consumer side, main context only),
+ * the function will return FALSE if the queue is empty.
+ */
+static boolean Scheduler_GetEvent(Scheduler_EventRecordType * record)
+{
+	uint8 head = g_queueHead;
+	volatile Scheduler_EventRecordType * slot;
+
+	if (head == g_queueTail)
+	{
+		return FALSE;
+	}
+
+	slot = &g_eventQueue[head & (SCHEDULER_QUEUE_SIZE - 1)];
+	record -> event = slot -> event;
+	record -> time = slot -> time;
+
+	/* Give the slot back to the producer only after it is read */
+	g_queueHead = head + 1;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Add an event record to the queue (producer side, to be called with the interrupts disabled).
+ */
+static boolean Scheduler_PutEvent(Scheduler_EventType event)
+{
+	uint8 tail = g_queueTail;
+	volatile Scheduler_EventRecordType * slot;
+
+	if ((uint8)(tail - g_queueHead) >= SCHEDULER_QUEUE_SIZE)
+	{
+		g_lostEvents++;
+		return FALSE;
+	}
+
+	slot = &g_eventQueue[tail & (SCHEDULER_QUEUE_SIZE - 1)];
+	slot -> event = event;
+	slot -> time = Timer1_GetTime();
+
+	/* Publish the record to the consumer only after it is written */
+	g_queueTail = tail + 1;
+	return TRUE;
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Empty the events queue and remove all the handlers.
+ */
+void Scheduler_Init(void)
+{
+	uint8 sreg = SREG;
+	Scheduler_EventType event;
+
+	cli();
+	for (event = 0; event < SCHEDULER_NUM_OF_EVENTS; event++)
+	{
+		g_eventHandler[event] = NULL_PTR;
+	}
+	g_queueHead = 0;
+	g_queueTail = 0;
+	g_lostEvents = 0;
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE)
+	g_busyTime = 0;
+#endif
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Set the function called by Scheduler_Run() for every posted event of this number.
+ */
+void Scheduler_SetHandler(Scheduler_EventType event, void(*a_ptr)(void))
+{
+	if (event < SCHEDULER_NUM_OF_EVENTS)
+	{
+		g_eventHandler[event] = a_ptr;
+	}
+}
+
+/*
+ * Description:
+ * Add the event with its Timer1 time stamp to the end of the queue.
+ * From an ISR the function takes constant time and does not disable the interrupts (the ISRs are the only producer),
+ * from main() (a handler) the interrupts are disabled for the insertion only, so main() does not race the ISRs.
+ * The function will return FALSE if the queue is full (the event is lost and counted).
+ */
+boolean Scheduler_PostEvent(Scheduler_EventType event)
+{
+	uint8 sreg = SREG;
+	boolean posted;
+
+	if (sreg & (1 << SREG_I))
+	{
+		/* Called from main() with the interrupts enabled: become part of the producer for a moment */
+		cli();
+		posted = Scheduler_PutEvent(event);
+		SREG = sreg;
+	}
+	else
+	{
+		posted = Scheduler_PutEvent(event);
+	}
+	return posted;
+}
+
+/*
+ * Description:
+ * The scheduler loop (never returns): take the events in order and run their handlers to completion,
+ * the CPU sleeps in idle mode while the queue is empty and wakes up at the next interrupt.
+ * To be called at the end of main() after the interrupts are enabled.
+ */
+void Scheduler_Run(void)
+{
+	Scheduler_EventType event;
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE) || (PROFILER_ENABLE == TRUE)
+	uint32 start;
+	uint32 end;
+#endif
+
+	/* The timers keep running in idle mode, so their interrupts wake the CPU up */
+	set_sleep_mode(SLEEP_MODE_IDLE);
+
+	while (1)
+	{
+		if (Scheduler_GetEvent(&g_currentEvent) == TRUE)
+		{
+			event = g_currentEvent.event;
+			if ((event < SCHEDULER_NUM_OF_EVENTS) && (g_eventHandler[event] != NULL_PTR))
+			{
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE) || (PROFILER_ENABLE == TRUE)
+				start = Timer1_GetTime();
+				(*g_eventHandler[event])();
+				end = Timer1_GetTime();
+				if (end < start)
+				{
+					end += TIMER1_TIME_WRAP;
+				}
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE)
+				g_busyTime += end - start;
+#endif
+#if (PROFILER_ENABLE == TRUE)
+				/* Latency from the post (time stamped by the ISR) to the handler start, the times are 16-bit */
+				Profiler_Record(PROFILER_FIRST_EVENT_ID + event,
+				                (uint16)((start < g_currentEvent.time) ? (start + TIMER1_TIME_WRAP - g_currentEvent.time) :
+				                                                         (start - g_currentEvent.time)),
+				                (uint16)(end - start));
+#endif
+#else
+				(*g_eventHandler[event])();
+#endif
+			}
+		}
+		else
+		{
+			/*
+			 * Sleep only if no event was posted after the queue was found empty:
+			 * the instruction after sei() is always executed before a pending interrupt,
+			 * so an interrupt coming between the check and the sleep wakes the CPU up directly.
+			 */
+			cli();
+			if (g_queueHead == g_queueTail)
+			{
+				sleep_enable();
+				sei();
+				sleep_cpu();
+				sleep_disable();
+			}
+			sei();
+		}
+	}
+}
+
+/*
+ * Description:
+ * The function will return the Timer1 time (see Timer1_GetTime()) at which the event being handled was posted,
+ * to be called from the handlers.
+ */
+uint32 Scheduler_GetEventTime(void)
+{
+	return g_currentEvent.time;
+}
+
+/*
+ * Description:
+ * The function will return the number of events lost because the queue was full.
+ */
+uint16 Scheduler_GetLostEvents(void)
+{
+	uint8 sreg = SREG;
+	uint16 lostEvents;
+
+	cli();
+	lostEvents = g_lostEvents;
+	SREG = sreg;
+	return lostEvents;
+}
+
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE)
+/*
+ * Description:
+ * The function will return the time spent in the handlers in Timer1 counts (see Timer1_GetTime()).
+ * The idle CPU time is the elapsed time minus this busy time.
+ */
+uint32 Scheduler_GetBusyTime(void)
+{
+	uint8 sreg = SREG;
+	uint32 busyTime;
+
+	cli();
+	busyTime = g_busyTime;
+	SREG = sreg;
+	return busyTime;
+}
+#endif
@@ -0,0 +1,102 @@
+/*******************************************************************************************************************
+ * File Name: Scheduler.h
+ * Date: 16/10/2026
+ * Driver: Event-Driven Run-To-Completion Scheduler Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Number of different events, every event has one handler */
+#ifndef SCHEDULER_NUM_OF_EVENTS
+#define SCHEDULER_NUM_OF_EVENTS                    12
+#endif
+
+/* Number of events which can wait in the queue (a power of two, up to 128) */
+#ifndef SCHEDULER_QUEUE_SIZE
+#define SCHEDULER_QUEUE_SIZE                       16
+#endif
+
+/*
+ * Build flag of the load measurement (e.g. -DSCHEDULER_LOAD_MEASUREMENT=TRUE): the time spent in the handlers is
+ * measured with the Timer1 time base, when FALSE the handlers are called directly (two time reads less per event).
+ */
+#ifndef SCHEDULER_LOAD_MEASUREMENT
+#define SCHEDULER_LOAD_MEASUREMENT                 FALSE
+#endif
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/* Event number: 0 .. SCHEDULER_NUM_OF_EVENTS-1 */
+typedef uint8 Scheduler_EventType;
+
+/* What is kept in the queue for every posted event */
+typedef struct {
+Scheduler_EventType event;
+uint32 time; /* Timer1 time (see Timer1_GetTime()) when the event was posted */
+} Scheduler_EventRecordType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Empty the events queue and remove all the handlers.
+ */
+void Scheduler_Init(void);
+
+/*
+ * Description:
+ * Set the function called by Scheduler_Run() for every posted event of this number.
+ */
+void Scheduler_SetHandler(Scheduler_EventType event, void(*a_ptr)(void));
+
+/*
+ * Description:
+ * Add the event with its Timer1 time stamp to the end of the queue.
+ * From an ISR the function takes constant time and does not disable the interrupts (the ISRs are the only producer),
+ * from main() (a handler) the interrupts are disabled for the insertion only, so main() does not race the ISRs.
+ * The function will return FALSE if the queue is full (the event is lost and counted).
+ */
+boolean Scheduler_PostEvent(Scheduler_EventType event);
+
+/*
+ * Description:
+ * The scheduler loop (never returns): take the events in order and run their handlers to completion,
+ * the CPU sleeps in idle mode while the queue is empty and wakes up at the next interrupt.
+ * To be called at the end of main() after the interrupts are enabled.
+ */
+void Scheduler_Run(void);
+
+/*
+ * Description:
+ * The function will return the Timer1 time (see Timer1_GetTime()) at which the event being handled was posted,
+ * to be called from the handlers.
+ */
+uint32 Scheduler_GetEventTime(void);
+
+/*
+ * Description:
+ * The function will return the number of events lost because the queue was full.
+ */
+uint16 Scheduler_GetLostEvents(void);
+
+#if (SCHEDULER_LOAD_MEASUREMENT == TRUE)
+/*
+ * Description:
+ * The function will return the time spent in the handlers in Timer1 counts (see Timer1_GetTime()).
+ * The idle CPU time is the elapsed time minus this busy time.
+ */
+uint32 Scheduler_GetBusyTime(void);
+#endif
+
+#endif /* SCHEDULER_H_ */
@@ -7,6 +7,82 @@
 #include "SevenSegment.h"
 #include "Common_Macros.h"
 #include "GPIO.h"
+#include <avr/pgmspace.h>
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Bit of each segment in the 7-segment PORT (without decoder) */
+#define SEVEN_SEGMENT_SEG_a                          (1 << SEVEN_SEGMENT_PIN1_a)
+#define SEVEN_SEGMENT_SEG_b                          (1 << SEVEN_SEGMENT_PIN2_b)
+#define SEVEN_SEGMENT_SEG_c                          (1 << SEVEN_SEGMENT_PIN3_c)
+#define SEVEN_SEGMENT_SEG_d                          (1 << SEVEN_SEGMENT_PIN4_d)
+#define SEVEN_SEGMENT_SEG_e                          (1 << SEVEN_SEGMENT_PIN5_e)
+#define SEVEN_SEGMENT_SEG_f                          (1 << SEVEN_SEGMENT_PIN6_f)
+#define SEVEN_SEGMENT_SEG_g                          (1 << SEVEN_SEGMENT_PIN7_g)
+#define SEVEN_SEGMENT_SEGMENTS_MASK                  (SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | \
+                                                      SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | \
+                                                      SEVEN_SEGMENT_SEG_g)
+
+#define SEVEN_SEGMENT_SEGMENTS_BLANK                 0
+
+/* The PORTs are fixed at compile time, so they can be written through the fast GPIO API */
+#if (SEVEN_SEGMENT_FAST_GPIO == TRUE)
+#define SEVEN_SEGMENT_WRITE_PORT_MASKED              GPIO_WritePortMasked_Fast
+#else
+#define SEVEN_SEGMENT_WRITE_PORT_MASKED              GPIO_WritePortMasked
+#endif
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/* Values to be displayed on the multiplexed 7-segments (written by the application, read by the refresh) */
+static volatile uint8 g_displayBuffer[SEVEN_SEGMENT_NUM_OF_DIGITS];
+
+/* The buffer read by the refresh: the internal buffer or a buffer of the application (no copy needed) */
+static const volatile uint8 * volatile g_displaySource = g_displayBuffer;
+
+/* The digit which is currently turned on */
+static uint8 g_currentDigit = 0;
+
+#if (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITHOUT_DECODER)
+
+/*
+ * Segments to be turned on for each glyph, stored in the flash (program memory) so it does not use RAM.
+ * Index: 0 .. 15 = hexadecimal digits, then SEVEN_SEGMENT_BLANK and SEVEN_SEGMENT_MINUS.
+ */
+static const uint8 g_segmentsTable[SEVEN_SEGMENT_NUM_OF_GLYPHS] PROGMEM =
+{
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f,                       /* 0 */
+	SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c,                                                                                                             /* 1 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_g,                                           /* 2 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_g,                                           /* 3 */
+	SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                                                                 /* 4 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                                           /* 5 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                     /* 6 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c,                                                                                       /* 7 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g, /* 8 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                     /* 9 */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                     /* A */
+	SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                                           /* b */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f,                                                                 /* C */
+	SEVEN_SEGMENT_SEG_b | SEVEN_SEGMENT_SEG_c | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_g,                                           /* d */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_d | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                                           /* E */
+	SEVEN_SEGMENT_SEG_a | SEVEN_SEGMENT_SEG_e | SEVEN_SEGMENT_SEG_f | SEVEN_SEGMENT_SEG_g,                                                                 /* F */
+	SEVEN_SEGMENT_SEGMENTS_BLANK,                                                                                                                          /* Blank */
+	SEVEN_SEGMENT_SEG_g                                                                                                                                    /* Minus */
+};
+
+#endif
+
+/* Select pin of each digit */
+static const uint8 g_selectPins[SEVEN_SEGMENT_NUM_OF_DIGITS] =
+{
+	SEVEN_SEGMENT_SELECT_DIGIT0_PIN_ID, SEVEN_SEGMENT_SELECT_DIGIT1_PIN_ID, SEVEN_SEGMENT_SELECT_DIGIT2_PIN_ID,
+	SEVEN_SEGMENT_SELECT_DIGIT3_PIN_ID, SEVEN_SEGMENT_SELECT_DIGIT4_PIN_ID, SEVEN_SEGMENT_SELECT_DIGIT5_PIN_ID
+};
 
 /****************************************************************************************
  *                                     Functions Definitions                            *
@@ -47,113 +123,138 @@ void SevenSegment_Init(void)
 /*
  * Description:
  * Display of Seven Segment Value without using a decoder.
+ * The value can be 0x00 .. 0x0F, SEVEN_SEGMENT_BLANK or SEVEN_SEGMENT_MINUS, any other value is shown as blank.
  */
 void SevenSegment_Display_Without_Decoder(uint8 count)
 {
-	/*
-	 * Common cathode seven segment with Etamini32 board
-	 * 0 -> PA0
-	 * a -> PA1
-	 * b -> PA2
-	 * c -> PA3
-	 * d -> PA4
-	 * e -> PA5
-	 * f -> PA6
-	 * g -> PA7
-	 */
-	switch(count)
+	uint8 segments = SEVEN_SEGMENT_SEGMENTS_BLANK;
+
+	/* One table read from the flash instead of a switch, values out of the table are shown as blank */
+	if (count < SEVEN_SEGMENT_NUM_OF_GLYPHS)
 	{
-	case 0:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_LOW);
-		break;
-	case 1:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_LOW);
-		break;
-	case 2:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 3:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 4:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 5:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 6:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 7:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_LOW);
-		break;
-	case 8:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
-	case 9:
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN1_a, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN2_b, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN3_c, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN4_d, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN5_e, LOGIC_LOW);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN6_f, LOGIC_HIGH);
-		GPIO_WritePin(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_PIN7_g, LOGIC_HIGH);
-		break;
+		segments = pgm_read_byte(&g_segmentsTable[count]);
 	}
 
+	/* Write all the segments of the digit in one write, so no intermediate value appears on the display */
+	SEVEN_SEGMENT_WRITE_PORT_MASKED(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_SEGMENTS_MASK, segments);
 }
 #endif
+
+#if (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITH_DECODER)
+
+/*
+ * Description:
+ * Display of Seven Segment Value using a BCD decoder (write the 4 bits of the value to the decoder pins).
+ * Values above 9 are shown as blank (the decoder turns all the segments off for the input 0x0F).
+ */
+void SevenSegment_Display_With_Decoder(uint8 count)
+{
+	uint8 value;
+
+	if (count > 9)
+	{
+		count = 0x0F;
+	}
+
+	/* Map the 4 bits of the value to the decoder pins and write them in one write */
+	value = (GET_BIT(count, 0) << SEVEN_SEGMENT_PIN0_ID) | (GET_BIT(count, 1) << SEVEN_SEGMENT_PIN1_ID) |
+	        (GET_BIT(count, 2) << SEVEN_SEGMENT_PIN2_ID) | (GET_BIT(count, 3) << SEVEN_SEGMENT_PIN3_ID);
+
+	SEVEN_SEGMENT_WRITE_PORT_MASKED(SEVEN_SEGMENT_PORT_ID, SEVEN_SEGMENT_DATA_MASK, value);
+}
+#endif
+
+/*
+ * Description:
+ * Setup the select pins of the multiplexed 7-segments as output pins and turn all the digits off.
+ * The digits are then refreshed one by one by calling SevenSegment_Multiplex_Refresh() periodically
+ * from a timer interrupt (the whole display is refreshed every SEVEN_SEGMENT_NUM_OF_DIGITS calls).
+ */
+void SevenSegment_Multiplex_Init(void)
+{
+	uint8 digit;
+
+	for (digit = 0; digit < SEVEN_SEGMENT_NUM_OF_DIGITS; digit++)
+	{
+		GPIO_SetupPinDirection(SEVEN_SEGMENT_SELECT_PORT_ID, g_selectPins[digit], OUTPUT_PIN);
+		GPIO_WritePin(SEVEN_SEGMENT_SELECT_PORT_ID, g_selectPins[digit], LOGIC_LOW);
+		g_displayBuffer[digit] = 0;
+	}
+	g_currentDigit = 0;
+}
+
+/*
+ * Description:
+ * Store the value to be displayed on the required digit in the display buffer.
+ * The value is shown at the next refresh of this digit, no need to wait for the display.
+ * If the digit number is not correct, the function will not handle the request
+ */
+void SevenSegment_Multiplex_SetDigit(uint8 digit_num, uint8 value)
+{
+	if (digit_num < SEVEN_SEGMENT_NUM_OF_DIGITS)
+	{
+		g_displayBuffer[digit_num] = value;
+	}
+	else
+	{
+		/* Do Nothing if the wrong digit number is entered */
+	}
+}
+
+/*
+ * Description:
+ * Make the multiplexing read the digits directly from the application buffer (at least
+ * SEVEN_SEGMENT_NUM_OF_DIGITS values, digit 0 first) instead of the internal display buffer,
+ * so a value changed by the application is displayed without calling SevenSegment_Multiplex_SetDigit.
+ * Passing NULL_PTR goes back to the internal display buffer.
+ */
+void SevenSegment_Multiplex_SetBuffer(const volatile uint8 * buffer)
+{
+	if (buffer == NULL_PTR)
+	{
+		g_displaySource = g_displayBuffer;
+	}
+	else
+	{
+		g_displaySource = buffer;
+	}
+}
+
+/*
+ * Description:
+ * Turn off the current digit and show the next digit from the display buffer.
+ * The function is designed to be called from a timer ISR (or its call back) every digit slot.
+ */
+void SevenSegment_Multiplex_Refresh(void)
+{
+	uint8 digit = g_currentDigit;
+
+	/* Turn off the current digit first, so the new value does not appear on it (ghosting) */
+	SEVEN_SEGMENT_WRITE_PORT_MASKED(SEVEN_SEGMENT_SELECT_PORT_ID, SEVEN_SEGMENT_SELECT_MASK, 0);
+
+	digit++;
+	if (digit == SEVEN_SEGMENT_NUM_OF_DIGITS)
+	{
+		digit = 0;
+	}
+
+#if (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITH_DECODER)
+	SevenSegment_Display_With_Decoder(g_displaySource[digit]);
+#elif (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITHOUT_DECODER)
+	SevenSegment_Display_Without_Decoder(g_displaySource[digit]);
+#endif
+
+	/* Turn on the next digit after its value is ready on the data pins */
+	SEVEN_SEGMENT_WRITE_PORT_MASKED(SEVEN_SEGMENT_SELECT_PORT_ID, SEVEN_SEGMENT_SELECT_MASK, (1 << g_selectPins[digit]));
+	g_currentDigit = digit;
+}
+
+/*
+ * Description:
+ * Turn all the multiplexed digits off (to be called after the refresh timer is stopped, or to blank the current
+ * digit for the rest of its slot). The next call of SevenSegment_Multiplex_Refresh() turns the display on again.
+ */
+void SevenSegment_Multiplex_Off(void)
+{
+	SEVEN_SEGMENT_WRITE_PORT_MASKED(SEVEN_SEGMENT_SELECT_PORT_ID, SEVEN_SEGMENT_SELECT_MASK, 0);
+}
@@ -11,6 +11,9 @@
 
 #define SEVEN_SEGMENT_MODE  SEVEN_SEGMENT_WITH_DECODER
 
+/* TRUE: the 7-segment PORTs are written through the compile-time GPIO API (no function call per write) */
+#define SEVEN_SEGMENT_FAST_GPIO  TRUE
+
 #if ((SEVEN_SEGMENT_MODE != SEVEN_SEGMENT_WITH_DECODER) || (SEVEN_SEGMENT_MODE != SEVEN_SEGMENT_WITHOUT_DECODER))
 
 #error " There is only Seven segment with decoder or seven segment without decoder"
@@ -36,6 +39,10 @@
 #define SEVEN_SEGMENT_PIN2_ID                        PIN2_ID
 #define SEVEN_SEGMENT_PIN3_ID                        PIN3_ID
 
+/* The 4 decoder pins, to write the BCD value in one write */
+#define SEVEN_SEGMENT_DATA_MASK                      ((1 << SEVEN_SEGMENT_PIN0_ID) | (1 << SEVEN_SEGMENT_PIN1_ID) | \
+                                                      (1 << SEVEN_SEGMENT_PIN2_ID) | (1 << SEVEN_SEGMENT_PIN3_ID))
+
 #elif (SEVEN_SEGMENT_MODE == SEVEN_SEGMENT_WITHOUT_DECODER)
 
 /* Define the common cathode pin which enables the seven segment */
@@ -63,6 +70,35 @@
 
 #endif
 
+/*
+ * Glyphs which can be displayed (value passed to the display functions):
+ * 0 .. 9 decimal digits, 0x0A .. 0x0F hexadecimal digits (without decoder only), blank and minus sign.
+ * The BCD decoder can only show 0 .. 9, any other value is shown as blank.
+ */
+#define SEVEN_SEGMENT_BLANK                          0x10
+#define SEVEN_SEGMENT_MINUS                          0x11
+#define SEVEN_SEGMENT_NUM_OF_GLYPHS                  0x12
+
+/* Setup the multiplexed display: six 7-segments sharing the same data pins, each one enabled by a select pin */
+#define SEVEN_SEGMENT_NUM_OF_DIGITS                  6
+#define SEVEN_SEGMENT_SELECT_PORT_ID                 PORTA_ID
+
+/* Select pin of each 7-Segment starting from the right most digit (digit 0) */
+#define SEVEN_SEGMENT_SELECT_DIGIT0_PIN_ID           PIN0_ID
+#define SEVEN_SEGMENT_SELECT_DIGIT1_PIN_ID           PIN1_ID
+#define SEVEN_SEGMENT_SELECT_DIGIT2_PIN_ID           PIN2_ID
+#define SEVEN_SEGMENT_SELECT_DIGIT3_PIN_ID           PIN3_ID
+#define SEVEN_SEGMENT_SELECT_DIGIT4_PIN_ID           PIN4_ID
+#define SEVEN_SEGMENT_SELECT_DIGIT5_PIN_ID           PIN5_ID
+
+/* All the select pins, to turn all the digits off in one write */
+#define SEVEN_SEGMENT_SELECT_MASK                    ((1 << SEVEN_SEGMENT_SELECT_DIGIT0_PIN_ID) | \
+                                                      (1 << SEVEN_SEGMENT_SELECT_DIGIT1_PIN_ID) | \
+                                                      (1 << SEVEN_SEGMENT_SELECT_DIGIT2_PIN_ID) | \
+                                                      (1 << SEVEN_SEGMENT_SELECT_DIGIT3_PIN_ID) | \
+                                                      (1 << SEVEN_SEGMENT_SELECT_DIGIT4_PIN_ID) | \
+                                                      (1 << SEVEN_SEGMENT_SELECT_DIGIT5_PIN_ID))
+
 /*******************************************************************************************
  *                                      Functions Prototypes                               *
  *******************************************************************************************/
@@ -78,7 +114,54 @@ void SevenSegment_Init(void);
 /*
  * Description:
  * Display of Seven Segment Value without using a decoder.
+ * The value can be 0x00 .. 0x0F, SEVEN_SEGMENT_BLANK or SEVEN_SEGMENT_MINUS, any other value is shown as blank.
  */
 void SevenSegment_Display_Without_Decoder(uint8 count);
 
+/*
+ * Description:
+ * Display of Seven Segment Value using a BCD decoder (write the 4 bits of the value to the decoder pins).
+ * Values above 9 are shown as blank (the decoder turns all the segments off for the input 0x0F).
+ */
+void SevenSegment_Display_With_Decoder(uint8 count);
+
+/*
+ * Description:
+ * Setup the select pins of the multiplexed 7-segments as output pins and turn all the digits off.
+ * The digits are then refreshed one by one by calling SevenSegment_Multiplex_Refresh() periodically
+ * from a timer interrupt (the whole display is refreshed every SEVEN_SEGMENT_NUM_OF_DIGITS calls).
+ */
+void SevenSegment_Multiplex_Init(void);
+
+/*
+ * Description:
+ * Store the value to be displayed on the required digit in the display buffer.
+ * The value is shown at the next refresh of this digit, no need to wait for the display.
+ * If the digit number is not correct, the function will not handle the request
+ */
+void SevenSegment_Multiplex_SetDigit(uint8 digit_num, uint8 value);
+
+/*
+ * Description:
+ * Make the multiplexing read the digits directly from the application buffer (at least
+ * SEVEN_SEGMENT_NUM_OF_DIGITS values, digit 0 first) instead of the internal display buffer,
+ * so a value changed by the application is displayed without calling SevenSegment_Multiplex_SetDigit.
+ * Passing NULL_PTR goes back to the internal display buffer.
+ */
+void SevenSegment_Multiplex_SetBuffer(const volatile uint8 * buffer);
+
+/*
+ * Description:
+ * Turn off the current digit and show the next digit from the display buffer.
+ * The function is designed to be called from a timer ISR (or its call back) every digit slot.
+ */
+void SevenSegment_Multiplex_Refresh(void);
+
+/*
+ * Description:
+ * Turn all the multiplexed digits off (to be called after the refresh timer is stopped, or to blank the current
+ * digit for the rest of its slot). The next call of SevenSegment_Multiplex_Refresh() turns the display on again.
+ */
+void SevenSegment_Multiplex_Off(void);
+
 #endif /* SEVENSEGMENT_H_ */
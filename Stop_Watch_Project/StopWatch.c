@@ -0,0 +1,529 @@
+/*******************************************************************************************************************
+ * File Name: StopWatch.c
+ * Date: 16/10/2026
+ * Driver: Stop-Watch Time Keeping Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "StopWatch.h"
+#include "SevenSegment.h"
+#include "TIMER1.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#if (TIMER1_TICK_HZ != STOPWATCH_TICK_HZ)
+#error "The Timer1 time base must tick at STOPWATCH_TICK_HZ"
+#endif
+
+#if ((STOPWATCH_NUM_OF_CHANNELS < 1) || (STOPWATCH_NUM_OF_CHANNELS > 8))
+#error "STOPWATCH_NUM_OF_CHANNELS must be 1 .. 8 (one bit per channel in the running mask)"
+#endif
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * The whole state of the stop-watch is kept in the .noinit section, which the start-up code does not clear,
+ * so it is still there after a reset which is not a power-on (see StopWatch_WarmRestart()).
+ */
+#ifndef STOPWATCH_NOINIT
+#define STOPWATCH_NOINIT                           __attribute__((section(".noinit")))
+#endif
+
+/* Written at the end of StopWatch_Init(), the .noinit RAM has a random value after a power-on */
+#define STOPWATCH_WARM_MAGIC                       0x5357
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/*
+ * The time of every channel as cascaded BCD digits, least significant first (see STOPWATCH_MILLISECONDS_UNITS ...).
+ * The channels are packed one after the other, so the tick walks a single array.
+ * The 7-segments multiplexing reads its six digits directly from a window of the displayed channel.
+ */
+static volatile uint8 g_timeDigits[STOPWATCH_NUM_OF_CHANNELS][STOPWATCH_NUM_OF_DIGITS] STOPWATCH_NOINIT;
+
+/* Sum of the digits of every channel, updated with the digits by the tick (one addition per millisecond) */
+static uint8 g_timeChecksum[STOPWATCH_NUM_OF_CHANNELS] STOPWATCH_NOINIT;
+
+/*
+ * Sequence counter of the time (seqlock): incremented before and after StopWatch_Tick() changes the digits,
+ * so it is odd while the digits are changed and a reader which sees the same even value before and after
+ * its copy has a consistent time. It is one byte, so it is read and written atomically by the AVR.
+ */
+static volatile uint8 g_timeSequence STOPWATCH_NOINIT;
+
+/* The last value of each digit before it rolls over to zero and carries to the next digit */
+static const uint8 g_timeDigitsMax[STOPWATCH_NUM_OF_DIGITS] = {9, 9, 9, 9, 5, 9, 5, 9, 2};
+
+static StopWatch_DisplayMode g_displayMode STOPWATCH_NOINIT;
+static StopWatch_ChannelType g_displayChannel STOPWATCH_NOINIT;
+
+/*
+ * Timer1 keeps ticking while a channel is stopped (it is shared with the software timers),
+ * so the run/stop is done here and the part of the millisecond counted before a stop is kept:
+ * g_runningMask: bit n is set while channel n is counting.
+ * g_fraction: timer counts of the current millisecond counted before the last start, minus the tick phase at the start
+ *             (plus g_skipTicks ticks), always 0 .. TIMER1_TICK_COUNTS-1 while running.
+ * g_skipTicks: ticks to ignore after a start, as they were already counted in g_fraction.
+ */
+static volatile uint8 g_runningMask STOPWATCH_NOINIT;
+static sint32 g_fraction[STOPWATCH_NUM_OF_CHANNELS] STOPWATCH_NOINIT;
+static volatile uint8 g_skipTicks[STOPWATCH_NUM_OF_CHANNELS] STOPWATCH_NOINIT;
+
+/* Checksum of the state which is not the time (updated when it changes) and the valid state marker */
+static uint8 g_configChecksum STOPWATCH_NOINIT;
+static uint16 g_warmMagic STOPWATCH_NOINIT;
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Add one millisecond to the time of a channel: increment the least significant digit and ripple the carry.
+ */
+static inline void StopWatch_Increment(StopWatch_ChannelType channel)
+{
+	volatile uint8 * digits = g_timeDigits[channel];
+	uint8 checksum = g_timeChecksum[channel];
+	uint8 digit = 0;
+
+	/* Nine times out of ten the loop body does not run at all */
+	while ((digit < STOPWATCH_NUM_OF_DIGITS) && (digits[digit] == g_timeDigitsMax[digit]))
+	{
+		digits[digit] = 0;
+		checksum -= g_timeDigitsMax[digit];
+		digit++;
+	}
+
+	if (digit < STOPWATCH_NUM_OF_DIGITS)
+	{
+		digits[digit]++;
+		checksum++;
+
+		/* Hours roll over from 23 to 00 (all the lower digits are already zero at this point) */
+		if ((digit == STOPWATCH_HOURS_UNITS) && (digits[STOPWATCH_HOURS_TENS] == 2) &&
+		    (digits[STOPWATCH_HOURS_UNITS] == 4))
+		{
+			digits[STOPWATCH_HOURS_UNITS] = 0;
+			digits[STOPWATCH_HOURS_TENS] = 0;
+			checksum -= 6;
+		}
+	}
+	g_timeChecksum[channel] = checksum;
+}
+
+/*
+ * Description:
+ * The function will return the sum of the digits of the channel.
+ */
+static uint8 StopWatch_TimeSum(StopWatch_ChannelType channel)
+{
+	uint8 sum = 0;
+	uint8 digit;
+
+	for (digit = 0; digit < STOPWATCH_NUM_OF_DIGITS; digit++)
+	{
+		sum += g_timeDigits[channel][digit];
+	}
+	return sum;
+}
+
+/*
+ * Description:
+ * The function will return the checksum (complement of the bytes sum) of the state which is not the time.
+ */
+static uint8 StopWatch_ConfigSum(void)
+{
+	const uint8 * bytes = (const uint8 *)g_fraction;
+	uint8 sum = g_runningMask + (uint8)g_displayMode + g_displayChannel;
+	uint8 index;
+
+	for (index = 0; index < sizeof(g_fraction); index++)
+	{
+		sum += bytes[index];
+	}
+	for (index = 0; index < STOPWATCH_NUM_OF_CHANNELS; index++)
+	{
+		sum += g_skipTicks[index];
+	}
+	return (uint8)~sum;
+}
+
+/*
+ * Description:
+ * Update the checksum after the state which is not the time is changed (from main() or the tick).
+ */
+static void StopWatch_SaveConfig(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_configChecksum = StopWatch_ConfigSum();
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Continue counting the channel from "fraction" timer counts of the current millisecond,
+ * starting at the current tick phase. To be called with the interrupts disabled.
+ */
+static void StopWatch_SyncPhase(StopWatch_ChannelType channel, sint32 fraction)
+{
+	uint8 skip = 0;
+
+	/* The phase can be up to two ticks when the compare match is pending */
+	fraction -= Timer1_GetTickPhase();
+
+	while (fraction < 0)
+	{
+		fraction += TIMER1_TICK_COUNTS;
+		skip++;
+	}
+	g_skipTicks[channel] = skip;
+	g_fraction[channel] = fraction;
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Clear the time of all the channels, show channel 0 on the multiplexed 7-segments in the required display mode
+ * and start counting channel 0 (the other channels are stopped).
+ * The 7-segment multiplexing must be initialized before calling this function. The Timer1 time base may be started
+ * after it (as main() does): until then the tick phase reads as 0, so channel 0 counts from the first tick.
+ */
+void StopWatch_Init(StopWatch_DisplayMode mode)
+{
+	StopWatch_ChannelType channel;
+
+	/* The .noinit RAM is not cleared by the start-up code, so every variable gets its first value here */
+	g_warmMagic = 0;
+	g_timeSequence = 0;
+	g_runningMask = 0;
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		StopWatch_Reset(channel);
+	}
+	g_displayChannel = 0;
+	StopWatch_SetDisplayMode(mode);
+	StopWatch_Start(0);
+	g_warmMagic = STOPWATCH_WARM_MAGIC;
+}
+
+/*
+ * Description:
+ * Continue after a reset which is not a power-on (watchdog, brown-out, external reset) from the state kept in the
+ * .noinit RAM: the time of all the channels, their running/stopped state, the display mode and the display channel.
+ * Only the part of the millisecond counted between the last tick and the reset is lost.
+ * The function will return FALSE if the state is not valid (magic, checksums, a tick interrupted by the reset
+ * or a value out of range), then StopWatch_Init() must be called.
+ * The 7-segment multiplexing must be initialized before calling this function. The Timer1 time base is started
+ * after it (as main() does), the time from the reset to this start is STOPWATCH_WARM_RESTART_COUNTS.
+ */
+boolean StopWatch_WarmRestart(void)
+{
+	StopWatch_ChannelType channel;
+	uint8 digit;
+
+	if ((g_warmMagic != STOPWATCH_WARM_MAGIC) || (g_timeSequence & 1) ||
+	    (g_configChecksum != StopWatch_ConfigSum()) || (g_displayChannel >= STOPWATCH_NUM_OF_CHANNELS) ||
+	    ((g_displayMode != StopWatch_SS_mmm) && (g_displayMode != StopWatch_MM_SS_cc) &&
+	     (g_displayMode != StopWatch_HH_MM_SS)) || ((g_runningMask >> STOPWATCH_NUM_OF_CHANNELS) != 0))
+	{
+		return FALSE;
+	}
+
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		if ((g_fraction[channel] < 0) || (g_fraction[channel] >= (sint32)TIMER1_TICK_COUNTS) ||
+		    (g_timeChecksum[channel] != StopWatch_TimeSum(channel)))
+		{
+			return FALSE;
+		}
+		for (digit = 0; digit < STOPWATCH_NUM_OF_DIGITS; digit++)
+		{
+			if (g_timeDigits[channel][digit] > g_timeDigitsMax[digit])
+			{
+				return FALSE;
+			}
+		}
+		if ((g_timeDigits[channel][STOPWATCH_HOURS_TENS] == 2) && (g_timeDigits[channel][STOPWATCH_HOURS_UNITS] > 3))
+		{
+			return FALSE;
+		}
+	}
+
+	/* The running channels continue with the next tick, after the time of the restart is added */
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		if (g_runningMask & (1 << channel))
+		{
+			g_fraction[channel] += STOPWATCH_WARM_RESTART_COUNTS;
+			while (g_fraction[channel] >= (sint32)TIMER1_TICK_COUNTS)
+			{
+				g_fraction[channel] -= TIMER1_TICK_COUNTS;
+				StopWatch_Increment(channel);
+			}
+		}
+	}
+	StopWatch_SaveConfig();
+
+	SevenSegment_Multiplex_SetBuffer(&g_timeDigits[g_displayChannel][g_displayMode]);
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Add one millisecond to the time of every running channel
+ * (9 -> 0 for units and milliseconds, 5 -> 0 for tens of seconds and minutes, 23 -> 00 for hours).
+ * To be called from the time base interrupt at STOPWATCH_TICK_HZ.
+ */
+void StopWatch_Tick(void)
+{
+	uint8 runningMask = g_runningMask;
+	StopWatch_ChannelType channel;
+
+	if (runningMask == 0)
+	{
+		return;
+	}
+
+	g_timeSequence++;
+	for (channel = 0; runningMask != 0; channel++, runningMask >>= 1)
+	{
+		if (runningMask & 1)
+		{
+			if (g_skipTicks[channel] != 0)
+			{
+				/* This millisecond was already counted partially before the last stop */
+				g_skipTicks[channel]--;
+				StopWatch_SaveConfig();
+			}
+			else
+			{
+				StopWatch_Increment(channel);
+			}
+		}
+	}
+	g_timeSequence++;
+}
+
+/*
+ * Description:
+ * Continue counting the channel from the exact timer count where it was stopped.
+ */
+void StopWatch_Start(StopWatch_ChannelType channel)
+{
+	uint8 sreg = SREG;
+
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return;
+	}
+
+	cli();
+	if (!(g_runningMask & (1 << channel)))
+	{
+		StopWatch_SyncPhase(channel, g_fraction[channel]);
+		g_runningMask |= (1 << channel);
+		StopWatch_SaveConfig();
+	}
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Stop counting the channel, the time counted inside the current millisecond is kept for the next start.
+ */
+void StopWatch_Stop(StopWatch_ChannelType channel)
+{
+	uint8 sreg = SREG;
+	sint32 counts;
+
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return;
+	}
+
+	cli();
+	if (g_runningMask & (1 << channel))
+	{
+		g_runningMask &= ~(1 << channel);
+
+		/* Timer counts since the last millisecond added to the time */
+		counts = g_fraction[channel] + Timer1_GetTickPhase() - ((sint32)g_skipTicks[channel] * TIMER1_TICK_COUNTS);
+		g_skipTicks[channel] = 0;
+
+		/* A pending compare match may complete a millisecond which its ISR will not count any more */
+		while (counts >= (sint32)TIMER1_TICK_COUNTS)
+		{
+			counts -= TIMER1_TICK_COUNTS;
+			StopWatch_Increment(channel);
+		}
+		g_fraction[channel] = counts;
+		StopWatch_SaveConfig();
+	}
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * The function will return TRUE while the channel is counting.
+ */
+boolean StopWatch_IsRunning(StopWatch_ChannelType channel)
+{
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return FALSE;
+	}
+	return (g_runningMask & (1 << channel)) ? TRUE : FALSE;
+}
+
+/*
+ * Description:
+ * Clear the time of the channel to 00:00:00.000 and start its current millisecond from now
+ * (the running/stopped state is kept).
+ */
+void StopWatch_Reset(StopWatch_ChannelType channel)
+{
+	uint8 sreg = SREG;
+	uint8 digit;
+
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return;
+	}
+
+	cli();
+	for (digit = 0; digit < STOPWATCH_NUM_OF_DIGITS; digit++)
+	{
+		g_timeDigits[channel][digit] = 0;
+	}
+	g_timeChecksum[channel] = 0;
+
+	if (g_runningMask & (1 << channel))
+	{
+		StopWatch_SyncPhase(channel, 0);
+	}
+	else
+	{
+		g_fraction[channel] = 0;
+		g_skipTicks[channel] = 0;
+	}
+	StopWatch_SaveConfig();
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Set the time of the channel (e.g. restored after a power cycle) and start its current millisecond from now
+ * (the running/stopped state is kept). The function will return FALSE if the time is not valid.
+ */
+boolean StopWatch_SetTime(StopWatch_ChannelType channel, const StopWatch_TimeType * time)
+{
+	uint8 sreg = SREG;
+
+	if ((channel >= STOPWATCH_NUM_OF_CHANNELS) || (time == NULL_PTR) || (time -> hours > 23) ||
+	    (time -> minutes > 59) || (time -> seconds > 59) || (time -> milliseconds > 999))
+	{
+		return FALSE;
+	}
+
+	/* Start from a cleared time, so the fraction of the millisecond is handled the same way as a reset */
+	StopWatch_Reset(channel);
+
+	cli();
+	g_timeDigits[channel][STOPWATCH_HOURS_TENS] = time -> hours / 10;
+	g_timeDigits[channel][STOPWATCH_HOURS_UNITS] = time -> hours % 10;
+	g_timeDigits[channel][STOPWATCH_MINUTES_TENS] = time -> minutes / 10;
+	g_timeDigits[channel][STOPWATCH_MINUTES_UNITS] = time -> minutes % 10;
+	g_timeDigits[channel][STOPWATCH_SECONDS_TENS] = time -> seconds / 10;
+	g_timeDigits[channel][STOPWATCH_SECONDS_UNITS] = time -> seconds % 10;
+	g_timeDigits[channel][STOPWATCH_MILLISECONDS_HUNDREDS] = time -> milliseconds / 100;
+	g_timeDigits[channel][STOPWATCH_MILLISECONDS_TENS] = (time -> milliseconds / 10) % 10;
+	g_timeDigits[channel][STOPWATCH_MILLISECONDS_UNITS] = time -> milliseconds % 10;
+	g_timeChecksum[channel] = StopWatch_TimeSum(channel);
+	SREG = sreg;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Take a consistent copy of the time of the channel (all the digits from the same millisecond) in binary,
+ * without disabling the interrupts: the copy is done again if the Timer1 tick changed the time meanwhile.
+ * To be called from main() (the handlers), not from an ISR.
+ */
+void StopWatch_GetTime(StopWatch_ChannelType channel, StopWatch_TimeType * time)
+{
+	uint8 digits[STOPWATCH_NUM_OF_DIGITS];
+	uint8 sequence;
+	uint8 digit;
+
+	if ((channel >= STOPWATCH_NUM_OF_CHANNELS) || (time == NULL_PTR))
+	{
+		return;
+	}
+
+	do
+	{
+		sequence = g_timeSequence;
+		for (digit = 0; digit < STOPWATCH_NUM_OF_DIGITS; digit++)
+		{
+			digits[digit] = g_timeDigits[channel][digit];
+		}
+	} while ((sequence & 1) || (sequence != g_timeSequence));
+
+	time -> hours = (digits[STOPWATCH_HOURS_TENS] * 10) + digits[STOPWATCH_HOURS_UNITS];
+	time -> minutes = (digits[STOPWATCH_MINUTES_TENS] * 10) + digits[STOPWATCH_MINUTES_UNITS];
+	time -> seconds = (digits[STOPWATCH_SECONDS_TENS] * 10) + digits[STOPWATCH_SECONDS_UNITS];
+	time -> milliseconds = ((uint16)digits[STOPWATCH_MILLISECONDS_HUNDREDS] * 100) +
+	                       (digits[STOPWATCH_MILLISECONDS_TENS] * 10) + digits[STOPWATCH_MILLISECONDS_UNITS];
+}
+
+/*
+ * Description:
+ * Change what is shown on the six 7-segments at run time, the time counting is not affected.
+ */
+void StopWatch_SetDisplayMode(StopWatch_DisplayMode mode)
+{
+	g_displayMode = mode;
+	StopWatch_SaveConfig();
+	SevenSegment_Multiplex_SetBuffer(&g_timeDigits[g_displayChannel][mode]);
+}
+
+/*
+ * Description:
+ * The function will return the current display mode.
+ */
+StopWatch_DisplayMode StopWatch_GetDisplayMode(void)
+{
+	return g_displayMode;
+}
+
+/*
+ * Description:
+ * Choose the channel shown on the six 7-segments (in the current display mode), the time counting is not affected.
+ */
+void StopWatch_SetDisplayChannel(StopWatch_ChannelType channel)
+{
+	if (channel < STOPWATCH_NUM_OF_CHANNELS)
+	{
+		g_displayChannel = channel;
+		StopWatch_SaveConfig();
+		SevenSegment_Multiplex_SetBuffer(&g_timeDigits[channel][g_displayMode]);
+	}
+}
+
+/*
+ * Description:
+ * The function will return the channel shown on the six 7-segments.
+ */
+StopWatch_ChannelType StopWatch_GetDisplayChannel(void)
+{
+	return g_displayChannel;
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************************************************
+ * File Name: StopWatch.h
+ * Date: 16/10/2026
+ * Driver: Stop-Watch Time Keeping Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef STOPWATCH_H_
+#define STOPWATCH_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* The stop-watch counts milliseconds, StopWatch_Tick() must be called at this rate */
+#define STOPWATCH_TICK_HZ                          1000UL
+
+/*
+ * The time is kept as cascaded BCD digits (one digit per byte) starting from the least significant:
+ * milliseconds (3 digits), seconds (2 digits), minutes (2 digits) and hours (2 digits).
+ */
+#define STOPWATCH_NUM_OF_DIGITS                    9
+
+#define STOPWATCH_MILLISECONDS_UNITS               0
+#define STOPWATCH_MILLISECONDS_TENS                1
+#define STOPWATCH_MILLISECONDS_HUNDREDS            2
+#define STOPWATCH_SECONDS_UNITS                    3
+#define STOPWATCH_SECONDS_TENS                     4
+#define STOPWATCH_MINUTES_UNITS                    5
+#define STOPWATCH_MINUTES_TENS                     6
+#define STOPWATCH_HOURS_UNITS                      7
+#define STOPWATCH_HOURS_TENS                       8
+
+/*
+ * Timer1 counts from a reset to the restart of the time base by a warm restart (the reset time-out set by the SUT/CKSEL
+ * fuses + the start-up code + main() up to Timer1_NonPWm_Mode_Init()), added to the running channels by
+ * StopWatch_WarmRestart(). It depends on the fuses and the build, so it is 0 (not compensated) unless measured.
+ */
+#ifndef STOPWATCH_WARM_RESTART_COUNTS
+#define STOPWATCH_WARM_RESTART_COUNTS              0
+#endif
+
+/* Number of independent stop-watch channels counted by the same tick (1 .. 8) */
+#ifndef STOPWATCH_NUM_OF_CHANNELS
+#define STOPWATCH_NUM_OF_CHANNELS                  1
+#endif
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/*
+ * What is shown on the six 7-segments, the value of each mode is the first (right most) digit shown,
+ * so the display is a window of six consecutive time digits.
+ */
+typedef enum
+{
+	StopWatch_SS_mmm   = STOPWATCH_MILLISECONDS_UNITS,     /* M SS.mmm */
+	StopWatch_MM_SS_cc = STOPWATCH_MILLISECONDS_TENS,      /* MM:SS.cc */
+	StopWatch_HH_MM_SS = STOPWATCH_SECONDS_UNITS           /* HH:MM:SS */
+}StopWatch_DisplayMode;
+
+/* Index of a stop-watch channel: 0 .. STOPWATCH_NUM_OF_CHANNELS-1 */
+typedef uint8 StopWatch_ChannelType;
+
+/* Time of a channel in binary, returned by StopWatch_GetTime() */
+typedef struct {
+uint8 hours;
+uint8 minutes;
+uint8 seconds;
+uint16 milliseconds;
+} StopWatch_TimeType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Clear the time of all the channels, show channel 0 on the multiplexed 7-segments in the required display mode
+ * and start counting channel 0 (the other channels are stopped).
+ * The 7-segment multiplexing must be initialized before calling this function. The Timer1 time base may be started
+ * after it (as main() does): until then the tick phase reads as 0, so channel 0 counts from the first tick.
+ */
+void StopWatch_Init(StopWatch_DisplayMode mode);
+
+/*
+ * Description:
+ * Continue after a reset which is not a power-on (watchdog, brown-out, external reset) from the state kept in the
+ * .noinit RAM: the time of all the channels, their running/stopped state, the display mode and the display channel.
+ * Only the part of the millisecond counted between the last tick and the reset is lost.
+ * The function will return FALSE if the state is not valid (magic, checksums, a tick interrupted by the reset
+ * or a value out of range), then StopWatch_Init() must be called.
+ * The 7-segment multiplexing must be initialized before calling this function. The Timer1 time base is started
+ * after it (as main() does), the time from the reset to this start is STOPWATCH_WARM_RESTART_COUNTS.
+ */
+boolean StopWatch_WarmRestart(void);
+
+/*
+ * Description:
+ * Add one millisecond to the time of every running channel
+ * (9 -> 0 for units and milliseconds, 5 -> 0 for tens of seconds and minutes, 23 -> 00 for hours).
+ * To be called from the time base interrupt at STOPWATCH_TICK_HZ.
+ */
+void StopWatch_Tick(void);
+
+/*
+ * Description:
+ * Continue counting the channel from the exact timer count where it was stopped.
+ */
+void StopWatch_Start(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * Stop counting the channel, the time counted inside the current millisecond is kept for the next start.
+ */
+void StopWatch_Stop(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * The function will return TRUE while the channel is counting.
+ */
+boolean StopWatch_IsRunning(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * Clear the time of the channel to 00:00:00.000 and start its current millisecond from now
+ * (the running/stopped state is kept).
+ */
+void StopWatch_Reset(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * Set the time of the channel (e.g. restored after a power cycle) and start its current millisecond from now
+ * (the running/stopped state is kept). The function will return FALSE if the time is not valid.
+ */
+boolean StopWatch_SetTime(StopWatch_ChannelType channel, const StopWatch_TimeType * time);
+
+/*
+ * Description:
+ * Take a consistent copy of the time of the channel (all the digits from the same millisecond) in binary,
+ * without disabling the interrupts: the copy is done again if the Timer1 tick changed the time meanwhile.
+ * To be called from main() (the handlers), not from an ISR.
+ */
+void StopWatch_GetTime(StopWatch_ChannelType channel, StopWatch_TimeType * time);
+
+/*
+ * Description:
+ * Change what is shown on the six 7-segments at run time, the time counting is not affected.
+ */
+void StopWatch_SetDisplayMode(StopWatch_DisplayMode mode);
+
+/*
+ * Description:
+ * The function will return the current display mode.
+ */
+StopWatch_DisplayMode StopWatch_GetDisplayMode(void);
+
+/*
+ * Description:
+ * Choose the channel shown on the six 7-segments (in the current display mode), the time counting is not affected.
+ */
+void StopWatch_SetDisplayChannel(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * The function will return the channel shown on the six 7-segments.
+ */
+StopWatch_ChannelType StopWatch_GetDisplayChannel(void);
+
+#endif /* STOPWATCH_H_ */
@@ -2,83 +2,694 @@
  * [File]: StopWatchApplication.c
  * [Date]: 18/8/2023
  * [Objective]: Application for Stop-Watch based on six of seven segments to display the time.
- * [Drivers]: GPIO - External Interrupts - Timers - 7-Segment
+ *              The time is counted in milliseconds and shown as HH:MM:SS, MM:SS.cc or SS.mmm.
+ * [Drivers]: GPIO - External Interrupts - Timers - UART - EEPROM - Watchdog - 7-Segment
  * [Author]: Youssef Ahmed Zaki
  *************************************************************************************************************/
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <avr/wdt.h>
 #include "Common_Macros.h"
-#include <util/delay.h>
 
 /* MCAL Layer */
 #include "GPIO.h"
 #include "INT.h"
+#include "TIMER0.h"
 #include "TIMER1.h"
+#include "UART.h"
 
 /* HAL Layer */
 #include "SevenSegment.h"
 
+/* Service Layer */
+#include "StopWatch.h"
+#include "Scheduler.h"
+#include "Telemetry.h"
+#include "Command.h"
+#include "Persistence.h"
+#include "Watchdog.h"
+#include "Profiler.h"
+
+/************************************************************************************************************
+ *                                                Macros Definitions                                        *
+ ************************************************************************************************************/
+
+/*
+ * Every 7-segment is turned on for one slot, so the whole display is refreshed every 6 slots (12 ms = 83 Hz).
+ * Compile-time selection of the Timer0 pre-scaler from F_CPU (like the Timer1 tick in TIMER1.h):
+ * the smallest pre-scaler which fits one slot in the 8-bit OCR0 is used (best brightness resolution),
+ * the compare value is the number of timer counts in one slot - 1.
+ */
+#define DISPLAY_SLOT_TIME_US             2000UL
+#define DISPLAY_SLOT_CYCLES              ((F_CPU / 1000UL) * DISPLAY_SLOT_TIME_US / 1000UL)
+
+#if   ((DISPLAY_SLOT_CYCLES / 8UL) <= 256UL)
+#define DISPLAY_TIMER0_PRESCALER_VALUE   8UL
+#define DISPLAY_TIMER0_PRESCALER         Timer0_Prescaler_8
+#elif ((DISPLAY_SLOT_CYCLES / 64UL) <= 256UL)
+#define DISPLAY_TIMER0_PRESCALER_VALUE   64UL
+#define DISPLAY_TIMER0_PRESCALER         Timer0_Prescaler_64
+#elif ((DISPLAY_SLOT_CYCLES / 256UL) <= 256UL)
+#define DISPLAY_TIMER0_PRESCALER_VALUE   256UL
+#define DISPLAY_TIMER0_PRESCALER         Timer0_Prescaler_256
+#elif ((DISPLAY_SLOT_CYCLES / 1024UL) <= 256UL)
+#define DISPLAY_TIMER0_PRESCALER_VALUE   1024UL
+#define DISPLAY_TIMER0_PRESCALER         Timer0_Prescaler_1024
+#else
+#error "The display slot does not fit in Timer0 even with pre-scaler 1024, reduce DISPLAY_SLOT_TIME_US"
+#endif
+
+#define DISPLAY_TIMER0_COMPARE_VALUE     ((DISPLAY_SLOT_CYCLES / DISPLAY_TIMER0_PRESCALER_VALUE) - 1UL)
+
+/*
+ * Brightness: every slot is split by the Timer0 compare match in a lit part and a blank part (all the digits off),
+ * the slot length, so the refresh rate, does not change. Level DISPLAY_BRIGHTNESS_LEVELS is the full brightness
+ * (no blank part), level n lights the digit for n/DISPLAY_BRIGHTNESS_LEVELS of its slot ("bright <level>" command).
+ * Every part is at least DISPLAY_MIN_PART_COUNTS timer counts, so the ISR writes the next compare value in time
+ * (64 CPU cycles with pre-scaler 8, 2 timer counts with the bigger pre-scalers of the faster clocks).
+ */
+#define DISPLAY_BRIGHTNESS_LEVELS        16
+#define DISPLAY_BRIGHTNESS_DEFAULT       DISPLAY_BRIGHTNESS_LEVELS
+#define DISPLAY_SLOT_COUNTS              (DISPLAY_TIMER0_COMPARE_VALUE + 1UL)
+#define DISPLAY_MIN_PART_COUNTS          ((DISPLAY_TIMER0_PRESCALER_VALUE == 8UL) ? 8UL : 2UL)
+
+#if (DISPLAY_SLOT_COUNTS < (2UL * DISPLAY_MIN_PART_COUNTS))
+#error "The display slot is too short to be split for the brightness, increase DISPLAY_SLOT_TIME_US"
+#endif
+
+/*
+ * After a push button press its external interrupt is disabled for the bounce time,
+ * then enabled again by a one-shot software timer on the Timer1 tick (one tick = one millisecond).
+ */
+#define BUTTON_DEBOUNCE_TIME_MS          50
+
+#define RESET_BUTTON_EDGE                INT0_FALLING_EDGE
+#define PAUSE_BUTTON_EDGE                INT1_RISING_EDGE
+#define RESUME_BUTTON_EDGE               INT2_FALLING_EDGE
+
+/*
+ * The display (the biggest consumer) is turned off when no button is pressed for this time, the time keeps counting.
+ * The first press while the display is off only turns it on again. Set to FALSE to keep the display always on.
+ */
+#define DISPLAY_AUTO_OFF                 TRUE
+#define DISPLAY_OFF_TIMEOUT_MS           60000
+
+/*
+ * The time of the displayed channel is sent over the UART every TELEMETRY_PERIOD_MS, the buttons presses as they come.
+ * The baud rate must be reachable from F_CPU: at 1 MHz the closest standard rate is 9600 (0.2% error in double
+ * speed mode), 115200 needs a faster clock, e.g. F_CPU = 7372800 (one byte every 87 us, the UDRE ISR is a few us).
+ */
+#ifndef TELEMETRY_BAUD_RATE
+#define TELEMETRY_BAUD_RATE              9600UL
+#endif
+#define TELEMETRY_PERIOD_MS              100
+
+#if ((UART_REAL_BAUD_RATE(TELEMETRY_BAUD_RATE) * 50UL) < (TELEMETRY_BAUD_RATE * 49UL)) || \
+    ((UART_REAL_BAUD_RATE(TELEMETRY_BAUD_RATE) * 50UL) > (TELEMETRY_BAUD_RATE * 51UL))
+#error "TELEMETRY_BAUD_RATE can not be generated from F_CPU within 2%"
+#endif
+
+/*
+ * The time and the laps are saved in the EEPROM on every pause and reset, and every SAVE_PERIOD_MS while a channel
+ * is counting, then restored at the boot (stopped, as the time without power is not known).
+ */
+#define SAVE_PERIOD_MS                   60000
+
+/*
+ * Every WATCHDOG_PERIOD_MS the Timer1 tick checks that every task checked in within its deadline (in periods),
+ * only then the watchdog is reset. A task which misses its deadline is recorded in the .noinit RAM and the watchdog
+ * resets the MCU within WATCHDOG_TIMEOUT (the time continues after the reset, see StopWatch_WarmRestart()).
+ * The tick itself is supervised by the watchdog directly: if it stops nothing resets the watchdog.
+ * MAIN_TASK: the scheduler runs the handlers (a handler stuck or the queue blocked).
+ * DISPLAY_TASK: the Timer0 ISR refreshes the display (supervised while the display is on).
+ * UART_TASK: the UART transmitter empties its buffer (checked by the telemetry handler).
+ */
+#define WATCHDOG_PERIOD_MS               100
+#define WATCHDOG_TIMEOUT                 WDTO_500MS
+
+#define MAIN_TASK                        0
+#define DISPLAY_TASK                     1
+#define UART_TASK                        2
+
+#define MAIN_TASK_DEADLINE               3
+#define DISPLAY_TASK_DEADLINE            1
+#define UART_TASK_DEADLINE               5
+
+#if (WATCHDOG_NUM_OF_TASKS != (UART_TASK + 1))
+#error "WATCHDOG_NUM_OF_TASKS must be the number of tasks of the application"
+#endif
+
+/* Events posted by the interrupts and handled by the scheduler in main() */
+#define RESET_BUTTON_EVENT               0
+#define PAUSE_BUTTON_EVENT               1
+#define RESUME_BUTTON_EVENT              2
+#define DISPLAY_TIMEOUT_EVENT            3
+#define TELEMETRY_EVENT                  4
+#define COMMAND_EVENT                    5
+#define SAVE_PERIOD_EVENT                6
+#define SAVE_DONE_EVENT                  7
+#define WATCHDOG_EVENT                   8
+
+/*
+ * Software timers running at the same time (peak): the debounce of the 3 buttons, the display off timeout,
+ * the telemetry, save and watchdog periods.
+ */
+#define APPLICATION_NUM_OF_SOFT_TIMERS   7
+
+#if (TIMER1_NUM_OF_SOFT_TIMERS < APPLICATION_NUM_OF_SOFT_TIMERS)
+#error "TIMER1_NUM_OF_SOFT_TIMERS is less than the software timers used by the application"
+#endif
+
 /************************************************************************************************************
  *                                                Global Variables                                          *
  ************************************************************************************************************/
-unsigned char SEC = 0;
-unsigned char MIN = 0;
-unsigned char HOUR = 0;
+/*
+ * Timer0 Configuration (Display Refresh):
+ * Initial Value = 0
+ * Compare Value = one display slot
+ * Pre-scaler = F_CPU/8
+ * Timer0 Mode: CTC Mode (TOP value in OCR0 Register)
+ */
+static const Timer0_ConfigType g_displayTimerConfig = {0, DISPLAY_TIMER0_COMPARE_VALUE, DISPLAY_TIMER0_PRESCALER, Timer0_CTC_Mode};
+
+/*
+ * UART Configuration (Telemetry):
+ * Baud Rate = TELEMETRY_BAUD_RATE
+ * Frame = 8 data bits, no parity, 1 stop bit
+ */
+static const UART_ConfigType g_telemetryUartConfig = {TELEMETRY_BAUD_RATE, UART_8_Bits, UART_No_Parity, UART_1_Stop_Bit};
+
+/* Laps captured on every channel since its last reset, and the last laps (lap n is at (n - 1) % NUM_OF_LAPS) */
+static uint8 g_lapCount[STOPWATCH_NUM_OF_CHANNELS];
+static StopWatch_TimeType g_laps[STOPWATCH_NUM_OF_CHANNELS][PERSISTENCE_NUM_OF_LAPS];
+
+/* A save is waiting for the end of the previous one */
+static volatile boolean g_saveRequest = FALSE;
+
+/* Bytes sent by the UART at the last telemetry period */
+static uint8 g_uartSent = 0;
+
+/* Display mode of the "mode" command argument 0, 1, 2 */
+static const StopWatch_DisplayMode g_commandModes[] = {StopWatch_SS_mmm, StopWatch_MM_SS_cc, StopWatch_HH_MM_SS};
+
+/*
+ * Compare values of the lit and the blank parts of a slot (0 = no blank part, full brightness),
+ * the blank part of the running slot, taken with its lit part, and the part which is running now (Timer0 ISR only).
+ */
+static volatile uint8 g_displayLitCompare = DISPLAY_TIMER0_COMPARE_VALUE;
+static volatile uint8 g_displayBlankCompare = 0;
+static uint8 g_displaySlotBlankCompare = 0;
+static boolean g_displayBlank = FALSE;
+
+#if (DISPLAY_AUTO_OFF == TRUE)
+static boolean g_displayOn = TRUE;
+/* The running display off timeout, cleared by its call back when it expires */
+static volatile Timer1_SoftTimerId g_displayTimer = TIMER1_INVALID_SOFT_TIMER;
+#endif
 
 /************************************************************************************************************
- *                                                 STOP-WATCH TIMER                                         *
+ *                                                Buttons Debouncing                                        *
  ************************************************************************************************************/
-/* ISR Code of the Timer1 */
-ISR(TIMER1_COMPA_vect)
+/* Software timers call backs to enable the buttons interrupts again after the bounce time */
+static void ResetButton_Enable(void)
+{
+	INT0_Init(RESET_BUTTON_EDGE);
+}
+
+static void PauseButton_Enable(void)
+{
+	INT1_Init(PAUSE_BUTTON_EDGE);
+}
+
+static void ResumeButton_Enable(void)
 {
-	SEC++;
-	if (SEC == 60)
+	INT2_Init(RESUME_BUTTON_EDGE);
+}
+
+/*
+ * Start the bounce time of a button, its interrupt is enabled again by the call back at the end.
+ * If no software timer is free the interrupt is enabled again at once (the bounces may be taken as presses),
+ * a button must never stay disabled.
+ */
+static void Button_Debounce(void (*a_enable)(void))
+{
+	if (Timer1_SoftTimer_Start(BUTTON_DEBOUNCE_TIME_MS, Timer1_OneShot, a_enable) == TIMER1_INVALID_SOFT_TIMER)
 	{
-		SEC = 0;
-		MIN++;
+		(*a_enable)();
 	}
-	if (MIN == 60)
+}
+
+/************************************************************************************************************
+ *                                                Display Power                                             *
+ ************************************************************************************************************/
+/*
+ * Timer0 call back (ISR) at the end of every part of a slot: blank the digit at the end of the lit part,
+ * or show the next digit at the end of the slot and report that the display is alive.
+ * Both parts of a slot are taken at its start: a level changed during the lit part is used from the next slot,
+ * so the slot length never changes.
+ */
+static void Display_Refresh(void)
+{
+	if ((g_displayBlank == FALSE) && (g_displaySlotBlankCompare != 0))
 	{
-		MIN = 0;
-		HOUR++;
+		Timer0_SetCompareValue(g_displaySlotBlankCompare);
+		SevenSegment_Multiplex_Off();
+		g_displayBlank = TRUE;
+		return;
 	}
-	if (HOUR == 24)
+
+	g_displaySlotBlankCompare = g_displayBlankCompare;
+	Timer0_SetCompareValue(g_displayLitCompare);
+	SevenSegment_Multiplex_Refresh();
+	g_displayBlank = FALSE;
+	Watchdog_CheckIn(DISPLAY_TASK);
+}
+
+/*
+ * Description:
+ * Set the display brightness level 1 .. DISPLAY_BRIGHTNESS_LEVELS, it is used from the next slot,
+ * the function will return FALSE if the level is not correct.
+ */
+static boolean Display_SetBrightness(uint8 level)
+{
+	uint8 sreg = SREG;
+	uint16 litCounts;
+
+	if ((level == 0) || (level > DISPLAY_BRIGHTNESS_LEVELS))
 	{
-		SEC = 0;
-		MIN = 0;
-		HOUR = 0;
+		return FALSE;
 	}
+
+	litCounts = (uint16)((DISPLAY_SLOT_COUNTS * level) / DISPLAY_BRIGHTNESS_LEVELS);
+	if (litCounts < DISPLAY_MIN_PART_COUNTS)
+	{
+		litCounts = DISPLAY_MIN_PART_COUNTS;
+	}
+	else if ((level < DISPLAY_BRIGHTNESS_LEVELS) && (litCounts > (DISPLAY_SLOT_COUNTS - DISPLAY_MIN_PART_COUNTS)))
+	{
+		litCounts = DISPLAY_SLOT_COUNTS - DISPLAY_MIN_PART_COUNTS;
+	}
+
+	/* Both values are taken by the ISR at the start of the same slot */
+	cli();
+	g_displayLitCompare = (uint8)(litCounts - 1);
+	g_displayBlankCompare = (level < DISPLAY_BRIGHTNESS_LEVELS) ? (uint8)(DISPLAY_SLOT_COUNTS - litCounts - 1) : 0;
+	SREG = sreg;
+	return TRUE;
+}
+
+#if (DISPLAY_AUTO_OFF == TRUE)
+/* Software timer call back (Timer1 ISR): let main() turn the display off */
+static void Display_Timeout(void)
+{
+	g_displayTimer = TIMER1_INVALID_SOFT_TIMER;
+	Scheduler_PostEvent(DISPLAY_TIMEOUT_EVENT);
+}
+
+static void Display_Timeout_Handler(void)
+{
+	if (g_displayTimer != TIMER1_INVALID_SOFT_TIMER)
+	{
+		/* A button was pressed after the timeout expired, a new timeout is running */
+		return;
+	}
+
+	/* Stop the 2 ms refresh interrupt, so the CPU sleeps until the next millisecond tick */
+	Timer0_DeInit();
+	SevenSegment_Multiplex_Off();
+	Watchdog_Supervise(DISPLAY_TASK, 0);
+	g_displayOn = FALSE;
+}
+#endif
+
+/*
+ * Description:
+ * Restart the display off timeout after a button press, the function will return TRUE
+ * if the display was off (it is turned on and the press is not used for anything else).
+ */
+static boolean Display_Activity(void)
+{
+#if (DISPLAY_AUTO_OFF == TRUE)
+	boolean wasOff = (g_displayOn == FALSE) ? TRUE : FALSE;
+
+	if (g_displayTimer != TIMER1_INVALID_SOFT_TIMER)
+	{
+		Timer1_SoftTimer_Cancel(g_displayTimer);
+	}
+	g_displayTimer = Timer1_SoftTimer_Start(DISPLAY_OFF_TIMEOUT_MS, Timer1_OneShot, Display_Timeout);
+
+	if (wasOff == TRUE)
+	{
+		/* The first slot is a lit part of the full slot length, the next one has the brightness */
+		g_displayBlank = FALSE;
+		g_displaySlotBlankCompare = 0;
+		Timer0_Init(&g_displayTimerConfig);
+		Watchdog_Supervise(DISPLAY_TASK, DISPLAY_TASK_DEADLINE);
+		g_displayOn = TRUE;
+	}
+	return wasOff;
+#else
+	return FALSE;
+#endif
+}
+
+/************************************************************************************************************
+ *                                                    State Persistence                                     *
+ ************************************************************************************************************/
+/*
+ * Description:
+ * Save the time and the laps of all the channels in the EEPROM (in the background),
+ * if the previous save is still being written, the save is done again when it is complete.
+ */
+static void State_Save(void)
+{
+	Persistence_DataType data;
+	StopWatch_ChannelType channel;
+	uint8 lap;
+
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		StopWatch_GetTime(channel, &data.time[channel]);
+		data.lap_count[channel] = g_lapCount[channel];
+		for (lap = 0; lap < PERSISTENCE_NUM_OF_LAPS; lap++)
+		{
+			data.laps[channel][lap] = g_laps[channel][lap];
+		}
+	}
+
+	/* The request is set first, so the end of the previous save can not be missed */
+	g_saveRequest = TRUE;
+	if (Persistence_Save(&data) == TRUE)
+	{
+		g_saveRequest = FALSE;
+	}
+}
+
+/*
+ * Description:
+ * Restore the laps and (if required) the time saved before the power was lost, all the channels are stopped then.
+ */
+static void State_Restore(boolean restoreTime)
+{
+	Persistence_DataType data;
+	StopWatch_ChannelType channel;
+	uint8 lap;
+
+	if (Persistence_Restore(&data) == FALSE)
+	{
+		return;
+	}
+
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		if (restoreTime == TRUE)
+		{
+			StopWatch_Stop(channel);
+			StopWatch_SetTime(channel, &data.time[channel]);
+		}
+		g_lapCount[channel] = data.lap_count[channel];
+		for (lap = 0; lap < PERSISTENCE_NUM_OF_LAPS; lap++)
+		{
+			g_laps[channel][lap] = data.laps[channel][lap];
+		}
+	}
+}
+
+/* Periodic software timer call back (Timer1 ISR): let main() save the time */
+static void State_Period(void)
+{
+	Scheduler_PostEvent(SAVE_PERIOD_EVENT);
+}
+
+static void State_Period_Handler(void)
+{
+	StopWatch_ChannelType channel;
+
+	/* Nothing changed since the last save if all the channels are stopped */
+	for (channel = 0; channel < STOPWATCH_NUM_OF_CHANNELS; channel++)
+	{
+		if (StopWatch_IsRunning(channel) == TRUE)
+		{
+			State_Save();
+			return;
+		}
+	}
+}
+
+/* EEPROM call back (EEPROM ready ISR): a save is complete, let main() do the waiting one */
+static void State_Saved(void)
+{
+	if (g_saveRequest == TRUE)
+	{
+		Scheduler_PostEvent(SAVE_DONE_EVENT);
+	}
+}
+
+static void State_Saved_Handler(void)
+{
+	if (g_saveRequest == TRUE)
+	{
+		State_Save();
+	}
+}
+
+/************************************************************************************************************
+ *                                                    Telemetry                                             *
+ ************************************************************************************************************/
+/* Periodic software timer call back (Timer1 ISR): let main() send the time */
+static void Telemetry_Period(void)
+{
+	Scheduler_PostEvent(TELEMETRY_EVENT);
+}
+
+static void Telemetry_Handler(void)
+{
+	uint8 sent = UART_GetTxSent();
+
+	/* The UART is alive if it sent bytes since the last period or it has nothing to send */
+	if ((sent != g_uartSent) || (UART_GetTxFree() == UART_TX_BUFFER_SIZE))
+	{
+		Watchdog_CheckIn(UART_TASK);
+	}
+	g_uartSent = sent;
+
+	Telemetry_SendTime(StopWatch_GetDisplayChannel());
+}
+
+/*
+ * Description:
+ * Send the watchdog fault data kept across the resets (also sent at the boot and with the "status" command).
+ */
+static void Telemetry_SendFaults(void)
+{
+	Watchdog_FaultType faults;
+
+	Watchdog_GetFaults(&faults);
+	Telemetry_SendFault(faults.last_task, faults.resets, faults.misses, WATCHDOG_NUM_OF_TASKS);
+}
+
+/************************************************************************************************************
+ *                                                    Supervision                                           *
+ ************************************************************************************************************/
+/* Periodic software timer call back (Timer1 ISR): check the tasks, then let main() report that it is alive */
+static void Supervisor_Period(void)
+{
+	Watchdog_Period();
+	Scheduler_PostEvent(WATCHDOG_EVENT);
+}
+
+static void Supervisor_Handler(void)
+{
+	Watchdog_CheckIn(MAIN_TASK);
 }
 
 /************************************************************************************************************
  *                                                        RESET                                             *
  ************************************************************************************************************/
-/* Interrupt0 ISR */
+/* Interrupt0 ISR: ignore the bounces and let main() handle the press */
 ISR(INT0_vect)
 {
-	SEC = 0;
-	MIN = 0;
-	HOUR = 0;
+	PROFILER_ISR_ENTRY();
+
+	INT0_DeInit();
+	Scheduler_PostEvent(RESET_BUTTON_EVENT);
+
+	PROFILER_ISR_EXIT(PROFILER_INT0_ID);
+}
+
+/* Reset action of the button and of the "reset" command */
+static void Reset_Action(StopWatch_ChannelType channel)
+{
+	/* Clear the time and start the current millisecond from zero (the paused/running state is kept) */
+	StopWatch_Reset(channel);
+	g_lapCount[channel] = 0;
+	State_Save();
+}
+
+static void ResetButton_Handler(void)
+{
+	if (Display_Activity() == FALSE)
+	{
+		Reset_Action(StopWatch_GetDisplayChannel());
+	}
+	Telemetry_SendButton(RESET_BUTTON_EVENT, StopWatch_GetDisplayChannel());
+	Button_Debounce(ResetButton_Enable);
 }
 
 /************************************************************************************************************
  *                                                        PAUSE                                             *
  ************************************************************************************************************/
-/* Interrupt1 ISR */
+/* Interrupt1 ISR: ignore the bounces and let main() handle the press */
 ISR(INT1_vect)
 {
-	/* As TCCR1B register contains clock bits, so make it Zero stops the timer */
-	TCCR1B = 0;
+	PROFILER_ISR_ENTRY();
+
+	INT1_DeInit();
+	Scheduler_PostEvent(PAUSE_BUTTON_EVENT);
+
+	PROFILER_ISR_EXIT(PROFILER_INT1_ID);
+}
+
+/* Pause action of the button and of the "stop" command */
+static void Pause_Action(StopWatch_ChannelType channel)
+{
+	/* Stop counting, the current millisecond continues from the same timer count on resume */
+	StopWatch_Stop(channel);
+	State_Save();
+}
+
+static void PauseButton_Handler(void)
+{
+	if (Display_Activity() == FALSE)
+	{
+		Pause_Action(StopWatch_GetDisplayChannel());
+	}
+	Telemetry_SendButton(PAUSE_BUTTON_EVENT, StopWatch_GetDisplayChannel());
+	Button_Debounce(PauseButton_Enable);
 }
 
 /************************************************************************************************************
  *                                                        RESUME                                            *
  ************************************************************************************************************/
-/* Interrupt2 ISR*/
+/* Interrupt2 ISR: ignore the bounces and let main() handle the press */
 ISR(INT2_vect)
 {
-	/* re-enable the TCCR1B register to continue counting */
-	TCCR1B = (1<<WGM12) | (1<<CS10) | (1<<CS12);
+	PROFILER_ISR_ENTRY();
+
+	INT2_DeInit();
+	Scheduler_PostEvent(RESUME_BUTTON_EVENT);
+
+	PROFILER_ISR_EXIT(PROFILER_INT2_ID);
+}
+
+/* Resume action of the button and of the "start" command */
+static void Resume_Action(StopWatch_ChannelType channel)
+{
+	/* Continue counting */
+	StopWatch_Start(channel);
+}
+
+static void ResumeButton_Handler(void)
+{
+	if (Display_Activity() == FALSE)
+	{
+		Resume_Action(StopWatch_GetDisplayChannel());
+	}
+	Telemetry_SendButton(RESUME_BUTTON_EVENT, StopWatch_GetDisplayChannel());
+	Button_Debounce(ResumeButton_Enable);
+}
+
+/************************************************************************************************************
+ *                                                    Remote Commands                                       *
+ ************************************************************************************************************/
+/*
+ * UART receive ISR call back: let main() parse the line as soon as it is complete, or when the receive buffer is
+ * half full (a line longer than the buffer is parsed while it comes, instead of filling it with no end of line).
+ */
+static void Command_Received(uint8 data)
+{
+	if ((data == '\r') || (data == '\n') || (UART_GetRxCount() == (UART_RX_BUFFER_SIZE / 2)))
+	{
+		Scheduler_PostEvent(COMMAND_EVENT);
+	}
+}
+
+/*
+ * Description:
+ * Execute a command with the same actions as the buttons, the channel is the argument (the displayed one if none),
+ * the "mode" argument is 0 (SS.mmm), 1 (MM:SS.cc) or 2 (HH:MM:SS) and the "bright" argument is the brightness level
+ * 1 .. DISPLAY_BRIGHTNESS_LEVELS. Every command is acknowledged with the time from its end of line
+ * (the time stamp of the event) to here.
+ */
+static void Command_Execute(Command_Type command, uint8 argument)
+{
+	StopWatch_ChannelType channel = (argument == COMMAND_NO_ARGUMENT) ? StopWatch_GetDisplayChannel() : argument;
+	StopWatch_TimeType time;
+	uint32 latency;
+	boolean done = TRUE;
+
+	if ((command != Command_Mode) && (command != Command_Bright) && (channel >= STOPWATCH_NUM_OF_CHANNELS))
+	{
+		command = Command_Invalid;
+	}
+
+	switch (command)
+	{
+	case Command_Start:
+		Resume_Action(channel);
+		break;
+	case Command_Stop:
+		Pause_Action(channel);
+		break;
+	case Command_Reset:
+		Reset_Action(channel);
+		break;
+	case Command_Lap:
+		StopWatch_GetTime(channel, &time);
+		g_lapCount[channel]++;
+		g_laps[channel][(uint8)(g_lapCount[channel] - 1) % PERSISTENCE_NUM_OF_LAPS] = time;
+		Telemetry_SendLap(channel, g_lapCount[channel], &time);
+		break;
+	case Command_Mode:
+		if (argument < (sizeof(g_commandModes) / sizeof(g_commandModes[0])))
+		{
+			StopWatch_SetDisplayMode(g_commandModes[argument]);
+		}
+		else
+		{
+			done = FALSE;
+		}
+		channel = StopWatch_GetDisplayChannel();
+		break;
+	case Command_Status:
+		Telemetry_SendTime(channel);
+		Telemetry_SendFaults();
+		break;
+	case Command_Bright:
+		done = Display_SetBrightness(argument);
+		channel = StopWatch_GetDisplayChannel();
+		break;
+	default:
+		done = FALSE;
+		channel = StopWatch_GetDisplayChannel();
+		break;
+	}
+
+	latency = Timer1_GetTime();
+	if (latency < Scheduler_GetEventTime())
+	{
+		latency += TIMER1_TIME_WRAP;
+	}
+	latency -= Scheduler_GetEventTime();
+	Telemetry_SendCommand((done == TRUE) ? (uint8)command : TELEMETRY_COMMAND_ERROR, channel, latency);
+
+	/* A remote command counts as activity, the display is turned on if it was off */
+	Display_Activity();
+}
+
+static void Command_Handler(void)
+{
+	Command_Process();
 }
 
 /************************************************************************************************************
@@ -86,13 +697,8 @@ ISR(INT2_vect)
  ************************************************************************************************************/
 int main (void)
 {
-	/* Let pins [0:5] in PORTA as output pins to select the required 7-Segment to display the digit */
-	GPIO_SetupPinDirection(PORTA_ID, PIN0_ID, OUTPUT_PIN);
-	GPIO_SetupPinDirection(PORTA_ID, PIN1_ID, OUTPUT_PIN);
-	GPIO_SetupPinDirection(PORTA_ID, PIN2_ID, OUTPUT_PIN);
-	GPIO_SetupPinDirection(PORTA_ID, PIN3_ID, OUTPUT_PIN);
-	GPIO_SetupPinDirection(PORTA_ID, PIN4_ID, OUTPUT_PIN);
-	GPIO_SetupPinDirection(PORTA_ID, PIN5_ID, OUTPUT_PIN);
+	/* Why the last reset happened: power-on, external, brown-out, watchdog or JTAG reset flags */
+	uint8 resetFlags = MCUCSR;
 
 	/* INT0 and INT2 have "internal pull-up resistors", so we need to enable this pins to give them power */
 	GPIO_WritePin(PORTD_ID, PIN2_ID, LOGIC_HIGH);
@@ -101,52 +707,103 @@ int main (void)
 	/*
 	 * Timer1 Configuration:
 	 * Initial Value = 0
-	 * Compare Value = 1000 (to increment up to 1 second)
-	 * Pre-scaler = F_CPU/1024
+	 * Compare Value and Pre-scaler = computed from F_CPU for a tick of TIMER1_TICK_HZ (one millisecond)
 	 * Timer1 Mode: CTC Mode (TOP value in OCR1A Register)
-	 * Tick of timer is every "one second" (T-timer)
+	 * The remaining fraction of a timer count is compensated at every tick by the Timer1 driver
 	 */
-	Timer1_ConfigType Timer1_Config = {0, 1000, Prescaler_1024, CTC_4};
+	Timer1_ConfigType Timer1_Config = {0, TIMER1_TICK_COMPARE_VALUE, TIMER1_TICK_PRESCALER, CTC_4};
+	boolean warmRestart;
 
-	/* MCAL Drivers Initialization */
-	INT0_Init(INT0_FALLING_EDGE);
-	INT1_Init(INT1_RISING_EDGE);
-	INT2_Init(INT2_FALLING_EDGE);
-	Timer1_NonPWm_Mode_Init(&Timer1_Config);
+	/* The flags are cleared by writing zero, so the next reset is not taken for this one */
+	MCUCSR &= ~((1 << JTRF) | (1 << WDRF) | (1 << BORF) | (1 << EXTRF) | (1 << PORF));
 
 	/* HAL Drivers Initialization */
 	SevenSegment_Init();
+	SevenSegment_Multiplex_Init();
+
+	/*
+	 * After a watchdog, brown-out or external reset the time kept in the .noinit RAM continues where it was
+	 * (warm restart), after a power-on or if the kept time is not valid the stop-watch starts from zero.
+	 */
+	warmRestart = ((resetFlags & (1 << PORF)) == 0) ? StopWatch_WarmRestart() : FALSE;
+	if (warmRestart == FALSE)
+	{
+		StopWatch_Init(StopWatch_HH_MM_SS);
+	}
+
+	/*
+	 * The time is counted every Timer1 tick, the tick is shared with the buttons debouncing software timers.
+	 * Timer1 and the interrupts are started before the rest of the initialization, so the time counts again
+	 * a few microseconds after a warm restart reaches main() and no tick is lost while the other drivers start.
+	 */
+	Timer1_SetCallBack(StopWatch_Tick);
+	Timer1_NonPWm_Mode_Init(&Timer1_Config);
 
 	/* Activation of Global Interrupt Enable Bit (I-bit) to activate the interrupts */
 	SET_BIT(SREG, PIN7_ID);
 
-	while (1)
-	{
-		/*
-		 * Loop on all six of 7-segments to enable them all time and display the required number on the selected one.
-		 * Activate the required pin to select the required 7-segment.
-		 * Display the required number on the required 7-segment.
-		 * Delay 4 ms to prevent possible noises on 7-segment Screen.
-		 */
-		PORTA = (1<<PA0);
-		PORTC = ((PORTC & 0xF0) | (SEC % 10));
-		_delay_ms(4);
-		PORTA = (1<<PA1);
-		PORTC = ((PORTC & 0xF0) | (SEC / 10));
-		_delay_ms(4);
-		PORTA = (1<<PA2);
-		PORTC = ((PORTC & 0xF0) | (MIN % 10));
-		_delay_ms(4);
-		PORTA = (1<<PA3);
-		PORTC = ((PORTC & 0xF0) | (MIN / 10));
-		_delay_ms(4);
-		PORTA = (1<<PA4);
-		PORTC = ((PORTC & 0xF0) | (HOUR % 10));
-		_delay_ms(4);
-		PORTA = (1<<PA5);
-		PORTC = ((PORTC & 0xF0) | (HOUR / 10));
-		_delay_ms(4);
-	}
-}
+	/* The buttons presses are handled in main() by the scheduler */
+	Scheduler_Init();
+	Scheduler_SetHandler(RESET_BUTTON_EVENT, ResetButton_Handler);
+	Scheduler_SetHandler(PAUSE_BUTTON_EVENT, PauseButton_Handler);
+	Scheduler_SetHandler(RESUME_BUTTON_EVENT, ResumeButton_Handler);
+#if (DISPLAY_AUTO_OFF == TRUE)
+	Scheduler_SetHandler(DISPLAY_TIMEOUT_EVENT, Display_Timeout_Handler);
+#endif
+	Scheduler_SetHandler(TELEMETRY_EVENT, Telemetry_Handler);
+	Scheduler_SetHandler(COMMAND_EVENT, Command_Handler);
+	Scheduler_SetHandler(SAVE_PERIOD_EVENT, State_Period_Handler);
+	Scheduler_SetHandler(SAVE_DONE_EVENT, State_Saved_Handler);
+	Scheduler_SetHandler(WATCHDOG_EVENT, Supervisor_Handler);
 
+	/* MCAL Drivers Initialization */
+	INT0_Init(RESET_BUTTON_EDGE);
+	INT1_Init(PAUSE_BUTTON_EDGE);
+	INT2_Init(RESUME_BUTTON_EDGE);
+	UART_Init(&g_telemetryUartConfig);
+	UART_SetRxCallBack(Command_Received);
 
+	/*
+	 * After a power-on continue from the time saved in the EEPROM before the power was lost (if any),
+	 * the laps are not in the .noinit RAM, so they are always taken from the EEPROM.
+	 */
+	State_Restore((warmRestart == FALSE) ? TRUE : FALSE);
+	Persistence_SetCallBack(State_Saved);
+
+	/*
+	 * The watchdog supervises the tasks from now on, the fault data of the last watchdog reset (if any)
+	 * is sent first, so it is the first record after the boot.
+	 */
+	Watchdog_Init(WATCHDOG_TIMEOUT, (resetFlags & (1 << WDRF)) ? TRUE : FALSE);
+	Watchdog_Supervise(MAIN_TASK, MAIN_TASK_DEADLINE);
+	Watchdog_Supervise(UART_TASK, UART_TASK_DEADLINE);
+	Timer1_SoftTimer_Start(WATCHDOG_PERIOD_MS, Timer1_Periodic, Supervisor_Period);
+	Telemetry_SendFaults();
+
+	/* The display is refreshed one digit every slot, a slot is one or two (lit and blank parts) Timer0 compare matches */
+	Display_SetBrightness(DISPLAY_BRIGHTNESS_DEFAULT);
+	Timer0_SetCallBack(Display_Refresh);
+	Timer0_Init(&g_displayTimerConfig);
+	Watchdog_Supervise(DISPLAY_TASK, DISPLAY_TASK_DEADLINE);
+
+	/* The commands received over the UART use the same actions as the buttons */
+	Command_Init();
+	Command_SetCallBack(Command_Execute);
+
+	/* Stream the time over the UART */
+	Timer1_SoftTimer_Start(TELEMETRY_PERIOD_MS, Timer1_Periodic, Telemetry_Period);
+
+	/* Save the time while it is counting */
+	Timer1_SoftTimer_Start(SAVE_PERIOD_MS, Timer1_Periodic, State_Period);
+
+	/* Start the display off timeout */
+	Display_Activity();
+
+	/*
+	 * The time is counted by the Timer1 interrupt and the six 7-segments are multiplexed by the Timer0 interrupt,
+	 * everything else runs here as event handlers, the CPU sleeps (idle mode) between the interrupts.
+	 */
+	Scheduler_Run();
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+/*******************************************************************************************************************
+ * File Name: TIMER0.c
+ * Date: 16/10/2026
+ * Driver: ATmega32 TIMER0 Driver Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "TIMER0.h"
+#include "Common_Macros.h"
+#include "Profiler.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+/* Global variables to hold the address of the call back function in the application */
+static void (* volatile g_callBackPtr)(void) = NULL_PTR;
+
+/****************************************************************************************
+ *                                    Interrupt Service Routines                        *
+ ****************************************************************************************/
+ISR(TIMER0_COMP_vect)
+{
+	PROFILER_ISR_ENTRY();
+
+	if (g_callBackPtr != NULL_PTR)
+	{
+		/* Call the Call Back function in the application after the compare match */
+		(*g_callBackPtr)();
+	}
+
+	PROFILER_ISR_EXIT(PROFILER_TIMER0_COMP_ID);
+}
+
+ISR(TIMER0_OVF_vect)
+{
+	if (g_callBackPtr != NULL_PTR)
+	{
+		/* Call the Call Back function in the application after the overflow */
+		(*g_callBackPtr)();
+	}
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Initialization of Timer0 (Enable Timer0)
+ * 1. Let the TCNT0 Register = The Start value of the timer0.
+ * 2. Enable FOC0 bit in the TCCR0 Register (Non-PWM Mode).
+ * 3. Configure TCCR0 according to the required pre-scalar and the Timer0 Mode.
+ * 4. In CTC Mode Let OCR0 = the compare value (TOP Value) and enable the compare match interrupt,
+ *    otherwise enable the overflow interrupt.
+ */
+void Timer0_Init(const Timer0_ConfigType * Config_Ptr)
+{
+	TCNT0 = Config_Ptr -> initial_value;
+
+	if (Config_Ptr -> mode == Timer0_CTC_Mode)
+	{
+		OCR0 = Config_Ptr -> compare_value;
+		/*
+		 * Configuration for CTC Mode:
+		 * FOC0 = 1, WGM00 = 0, WGM01 = 1, COM01 = 0, COM00 = 0 (OC0 disconnected)
+		 */
+		TCCR0 = (1 << FOC0) | (1 << WGM01) | (Config_Ptr -> prescaler);
+		TIMSK = (TIMSK & ~(1 << TOIE0)) | (1 << OCIE0);
+	}
+	else
+	{
+		/*
+		 * Configuration for Normal Mode:
+		 * FOC0 = 1, WGM00 = 0, WGM01 = 0, COM01 = 0, COM00 = 0 (OC0 disconnected)
+		 */
+		TCCR0 = (1 << FOC0) | (Config_Ptr -> prescaler);
+		TIMSK = (TIMSK & ~(1 << OCIE0)) | (1 << TOIE0);
+	}
+}
+
+/*
+ * Description:
+ * Function to disable the Timer0.
+ */
+void Timer0_DeInit(void)
+{
+	TCCR0 = 0;
+	TCNT0 = 0;
+	OCR0 = 0;
+	TIMSK &= ~((1 << OCIE0) | (1 << TOIE0));
+}
+
+/*
+ * Description:
+ * Change the compare value (TOP in CTC Mode) while the timer is running, to be called from the compare match ISR
+ * (TCNT0 has just been cleared and OCR0 is not double buffered in CTC Mode), the new value is used for the period
+ * which has just started. If TCNT0 has already passed the new value (the ISR came late), the period is started
+ * again from zero, otherwise it would only end after TCNT0 rolls over at 0xFF.
+ */
+void Timer0_SetCompareValue(uint8 compare_value)
+{
+	OCR0 = compare_value;
+	if (TCNT0 >= compare_value)
+	{
+		TCNT0 = 0;
+	}
+}
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the Timer0 ISR (compare match or overflow according to the mode).
+ */
+void Timer0_SetCallBack(void(*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
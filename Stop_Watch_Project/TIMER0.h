@@ -0,0 +1,78 @@
+/*******************************************************************************************************************
+ * File Name: TIMER0.h
+ * Date: 16/10/2026
+ * Driver: ATmega32 Timer0 Driver Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef TIMER0_H_
+#define TIMER0_H_
+
+/*******************************************************************************************
+ *                                      Types Declaration                                  *
+ *******************************************************************************************/
+
+typedef enum
+{
+	Timer0_No_Clock,
+	Timer0_Prescaler_1,
+	Timer0_Prescaler_8,
+	Timer0_Prescaler_64,
+	Timer0_Prescaler_256,
+	Timer0_Prescaler_1024,
+	Timer0_External_Clock_Falling_Edge,
+	Timer0_External_Clock_Rising_Edge
+}Timer0_Prescaler;
+
+typedef enum
+{
+	Timer0_Normal_Mode,
+	Timer0_CTC_Mode
+}Timer0_Mode;
+
+typedef struct {
+uint8 initial_value;
+uint8 compare_value; /* it will be used in compare mode only. */
+Timer0_Prescaler prescaler;
+Timer0_Mode mode;
+} Timer0_ConfigType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description:
+ * Initialization of Timer0 (Enable Timer0)
+ * 1. Let the TCNT0 Register = The Start value of the timer0.
+ * 2. Enable FOC0 bit in the TCCR0 Register (Non-PWM Mode).
+ * 3. Configure TCCR0 according to the required pre-scalar and the Timer0 Mode.
+ * 4. In CTC Mode Let OCR0 = the compare value (TOP Value) and enable the compare match interrupt,
+ *    otherwise enable the overflow interrupt.
+ */
+void Timer0_Init(const Timer0_ConfigType * Config_Ptr);
+
+/*
+ * Description:
+ * Function to disable the Timer0.
+ */
+void Timer0_DeInit(void);
+
+/*
+ * Description:
+ * Change the compare value (TOP in CTC Mode) while the timer is running, to be called from the compare match ISR
+ * (TCNT0 has just been cleared and OCR0 is not double buffered in CTC Mode), the new value is used for the period
+ * which has just started. If TCNT0 has already passed the new value (the ISR came late), the period is started
+ * again from zero, otherwise it would only end after TCNT0 rolls over at 0xFF.
+ */
+void Timer0_SetCompareValue(uint8 compare_value);
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the Timer0 ISR (compare match or overflow according to the mode).
+ */
+void Timer0_SetCallBack(void(*a_ptr)(void));
+
+#endif /* TIMER0_H_ */
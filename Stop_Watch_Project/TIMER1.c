@@ -7,6 +7,7 @@
 #include "TIMER1.h"
 #include "Common_Macros.h"
 #include "GPIO.h"
+#include "Profiler.h"
 #include <avr/io.h>
 #include <avr/interrupt.h>
 
@@ -14,7 +15,312 @@
  *                                         Global Variables                            *
  ***************************************************************************************/
 /* Global variables to hold the address of the call back function in the application */
-static volatile void (*g_callBackPtr)(void) = NULL_PTR;
+static void (* volatile g_callBackPtr)(void) = NULL_PTR;
+
+/* Pre-scaler of Prescaler_1 .. Prescaler_1024 */
+static const uint16 g_prescalerValue[] = {1, 8, 64, 256, 1024};
+
+/* PWM configured by the last Timer1_PWM_Init(): TOP, fast or dual slope, and the outputs of OC1A and OC1B */
+static uint16 g_pwmTop = 0;
+static boolean g_pwmFast = FALSE;
+static Timer1_PwmOutput g_pwmOutput[2] = {Timer1_PWM_Disconnected, Timer1_PWM_Disconnected};
+
+/* Fast PWM: the outputs connected (TRUE) or disconnected for 0% at the next TOP, by the overflow interrupt */
+static volatile boolean g_pwmConnect[2] = {FALSE, FALSE};
+
+#if (TIMER1_TICK_REMAINDER != 0)
+/* Accumulated fraction of a timer count (in 1/TIMER1_TICK_DIVISOR) not yet added to the ticks */
+static uint16 g_timebaseError = 0;
+#endif
+
+/*
+ * Software timers pool: a timer is in use while its call back is not NULL.
+ * The timers in use are kept in the hierarchical timing wheel (a doubly linked list per wheel slot),
+ * the free ones in a free list linked through g_softTimerNext.
+ */
+static void (* volatile g_softTimerCallBack[TIMER1_NUM_OF_SOFT_TIMERS])(void);
+static uint16 g_softTimerPeriod[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint16 g_softTimerExpiry[TIMER1_NUM_OF_SOFT_TIMERS];
+static Timer1_SoftTimerType g_softTimerType[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint8 g_softTimerNext[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint8 g_softTimerPrev[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint8 g_softTimerSlot[TIMER1_NUM_OF_SOFT_TIMERS];
+static uint8 g_softTimerFreeHead = 0;
+static boolean g_softTimerFreeListReady = FALSE;
+
+/*
+ * Hierarchical timing wheel: TIMER1_WHEEL_LEVELS wheels of TIMER1_WHEEL_SLOTS slots, a slot of level n
+ * holds the timers expiring within TIMER1_WHEEL_SLOTS^n ticks. Level 0 is served every tick and a slot
+ * of the upper levels is moved down (cascaded) only when the lower wheel completes a turn.
+ */
+static uint8 g_wheelHead[TIMER1_WHEEL_LEVELS * TIMER1_WHEEL_SLOTS];
+static volatile uint16 g_wheelTime = 0;
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Drift compensation of the time base, called at every Timer1 compare match (CTC_4 mode
+ * configured with TIMER1_TICK_COMPARE_VALUE and TIMER1_TICK_PRESCALER).
+ * The fraction of a timer count lost by every tick is accumulated, and when it reaches a whole count
+ * the next tick is made one count longer, so the long-run tick rate is exactly TIMER1_TICK_HZ
+ * and a single tick is never wrong by more than one timer count.
+ */
+static inline void Timer1_Timebase_Update(void)
+{
+#if (TIMER1_TICK_REMAINDER != 0)
+	/*
+	 * TCNT1 has just been cleared by the compare match, so OCR1A (not double buffered in CTC mode)
+	 * can be changed safely here for the tick which has just started.
+	 */
+	g_timebaseError += TIMER1_TICK_REMAINDER;
+	if (g_timebaseError >= TIMER1_TICK_DIVISOR)
+	{
+		g_timebaseError -= TIMER1_TICK_DIVISOR;
+		OCR1A = TIMER1_TICK_COMPARE_VALUE + 1;
+	}
+	else
+	{
+		OCR1A = TIMER1_TICK_COMPARE_VALUE;
+	}
+#else
+	/* F_CPU is an exact multiple of the tick, nothing to compensate */
+#endif
+}
+
+/*
+ * Description:
+ * Link all the software timers in the free list and empty the wheel
+ * (done once, before the first software timer is started).
+ */
+static void Timer1_SoftTimer_InitFreeList(void)
+{
+	uint8 id;
+
+	for (id = 0; id < TIMER1_NUM_OF_SOFT_TIMERS; id++)
+	{
+		g_softTimerCallBack[id] = NULL_PTR;
+		g_softTimerNext[id] = id + 1;
+	}
+	g_softTimerNext[TIMER1_NUM_OF_SOFT_TIMERS - 1] = TIMER1_INVALID_SOFT_TIMER;
+	g_softTimerFreeHead = 0;
+
+	for (id = 0; id < (TIMER1_WHEEL_LEVELS * TIMER1_WHEEL_SLOTS); id++)
+	{
+		g_wheelHead[id] = TIMER1_INVALID_SOFT_TIMER;
+	}
+	g_softTimerFreeListReady = TRUE;
+}
+
+/*
+ * Description:
+ * Put the software timer in the wheel slot of its expiry tick (constant time):
+ * the lowest level whose turn covers the remaining ticks, the slot is the expiry digit of that level.
+ */
+static void Timer1_SoftTimer_Insert(uint8 id)
+{
+	uint16 expiry = g_softTimerExpiry[id];
+	uint16 remaining = expiry - g_wheelTime;
+	uint8 slot;
+
+	if (remaining < TIMER1_WHEEL_SLOTS)
+	{
+		slot = (uint8)(expiry & (TIMER1_WHEEL_SLOTS - 1));
+	}
+	else if (remaining < (TIMER1_WHEEL_SLOTS * TIMER1_WHEEL_SLOTS))
+	{
+		slot = TIMER1_WHEEL_SLOTS + (uint8)((expiry >> TIMER1_WHEEL_BITS) & (TIMER1_WHEEL_SLOTS - 1));
+	}
+	else if (remaining < (TIMER1_WHEEL_SLOTS * TIMER1_WHEEL_SLOTS * TIMER1_WHEEL_SLOTS))
+	{
+		slot = (2 * TIMER1_WHEEL_SLOTS) + (uint8)((expiry >> (2 * TIMER1_WHEEL_BITS)) & (TIMER1_WHEEL_SLOTS - 1));
+	}
+	else
+	{
+		slot = (3 * TIMER1_WHEEL_SLOTS) + (uint8)((expiry >> (3 * TIMER1_WHEEL_BITS)) & (TIMER1_WHEEL_SLOTS - 1));
+	}
+
+	g_softTimerSlot[id] = slot;
+	g_softTimerPrev[id] = TIMER1_INVALID_SOFT_TIMER;
+	g_softTimerNext[id] = g_wheelHead[slot];
+	if (g_wheelHead[slot] != TIMER1_INVALID_SOFT_TIMER)
+	{
+		g_softTimerPrev[g_wheelHead[slot]] = id;
+	}
+	g_wheelHead[slot] = id;
+}
+
+/*
+ * Description:
+ * Take the software timer out of its wheel slot (constant time).
+ */
+static void Timer1_SoftTimer_Remove(uint8 id)
+{
+	uint8 next = g_softTimerNext[id];
+	uint8 prev = g_softTimerPrev[id];
+
+	if (prev != TIMER1_INVALID_SOFT_TIMER)
+	{
+		g_softTimerNext[prev] = next;
+	}
+	else
+	{
+		g_wheelHead[g_softTimerSlot[id]] = next;
+	}
+	if (next != TIMER1_INVALID_SOFT_TIMER)
+	{
+		g_softTimerPrev[next] = prev;
+	}
+}
+
+/*
+ * Description:
+ * Move all the software timers of an upper level slot down to the lower levels (called when the slot is reached).
+ */
+static void Timer1_SoftTimer_Cascade(uint8 slot)
+{
+	uint8 id = g_wheelHead[slot];
+	uint8 next;
+
+	g_wheelHead[slot] = TIMER1_INVALID_SOFT_TIMER;
+	while (id != TIMER1_INVALID_SOFT_TIMER)
+	{
+		next = g_softTimerNext[id];
+		Timer1_SoftTimer_Insert(id);
+		id = next;
+	}
+}
+
+/*
+ * Description:
+ * Advance the wheel by one tick and call the expired software timers (called from the ISR).
+ * The work done every tick does not depend on the number of software timers in use:
+ * only the timers expiring at this tick are visited, plus one upper slot every TIMER1_WHEEL_SLOTS ticks.
+ */
+static inline void Timer1_SoftTimer_Dispatch(void)
+{
+	uint8 id;
+	uint8 slot;
+	void (*callBack)(void);
+
+	/* The wheel time is also the free running tick count returned by Timer1_GetTime() */
+	g_wheelTime++;
+
+	if (g_softTimerFreeListReady == FALSE)
+	{
+		/* No software timer was started yet, the wheel is not initialized */
+		return;
+	}
+
+	slot = (uint8)(g_wheelTime & (TIMER1_WHEEL_SLOTS - 1));
+
+	if (slot == 0)
+	{
+		/* The upper levels are cascaded from the highest, so a timer can be moved down more than one level */
+		if ((g_wheelTime & ((1U << (2 * TIMER1_WHEEL_BITS)) - 1)) == 0)
+		{
+			if ((g_wheelTime & ((1U << (3 * TIMER1_WHEEL_BITS)) - 1)) == 0)
+			{
+				Timer1_SoftTimer_Cascade((3 * TIMER1_WHEEL_SLOTS) + (uint8)(g_wheelTime >> (3 * TIMER1_WHEEL_BITS)));
+			}
+			Timer1_SoftTimer_Cascade((2 * TIMER1_WHEEL_SLOTS) +
+			                         (uint8)((g_wheelTime >> (2 * TIMER1_WHEEL_BITS)) & (TIMER1_WHEEL_SLOTS - 1)));
+		}
+		Timer1_SoftTimer_Cascade(TIMER1_WHEEL_SLOTS + (uint8)((g_wheelTime >> TIMER1_WHEEL_BITS) & (TIMER1_WHEEL_SLOTS - 1)));
+	}
+
+	/* The expired timers are taken one by one, a call back may start or cancel any other timer */
+	while ((id = g_wheelHead[slot]) != TIMER1_INVALID_SOFT_TIMER)
+	{
+		callBack = g_softTimerCallBack[id];
+		Timer1_SoftTimer_Remove(id);
+
+		if (g_softTimerType[id] == Timer1_Periodic)
+		{
+			/* The next expiry is counted from this one, so a periodic timer does not drift */
+			g_softTimerExpiry[id] += g_softTimerPeriod[id];
+			Timer1_SoftTimer_Insert(id);
+		}
+		else
+		{
+			/* Release the one-shot timer before its call back, so the call back can start it again */
+			g_softTimerCallBack[id] = NULL_PTR;
+			g_softTimerNext[id] = g_softTimerFreeHead;
+			g_softTimerFreeHead = id;
+		}
+		(*callBack)();
+	}
+}
+
+/****************************************************************************************
+ *                                    Interrupt Service Routines                        *
+ ****************************************************************************************/
+ISR(TIMER1_COMPA_vect)
+{
+	/* TCNT1 is cleared by the compare match, so its value at the entry is the latency */
+	PROFILER_ISR_ENTRY();
+
+	Timer1_Timebase_Update();
+
+	if (g_callBackPtr != NULL_PTR)
+	{
+		/* Call the Call Back function in the application at every tick */
+		(*g_callBackPtr)();
+	}
+
+	Timer1_SoftTimer_Dispatch();
+
+	PROFILER_ISR_EXIT(PROFILER_TIMER1_COMPA_ID);
+}
+
+/*
+ * Description:
+ * Connect the PWM output of the channel to its pin (COM1x1:0 configured by Timer1_PWM_Init()) or disconnect it,
+ * to be called with the interrupts disabled.
+ */
+static void Timer1_PWM_Connect(uint8 channel, boolean connect)
+{
+	uint8 shift = (channel == Timer1_Channel_A) ? COM1A0 : COM1B0;
+
+	TCCR1A = (TCCR1A & ~(0x03 << shift)) | ((connect == TRUE) ? ((uint8)g_pwmOutput[channel] << shift) : 0);
+}
+
+/*
+ * Description:
+ * Fast PWM: connect or disconnect the output of the channel at the next TOP, when the compare value written now
+ * is loaded (a connection changed in the middle of a period would cut the pulse or start with a stale output),
+ * to be called with the interrupts disabled.
+ */
+static void Timer1_PWM_ConnectAtTop(uint8 channel, boolean connect)
+{
+	uint8 shift = (channel == Timer1_Channel_A) ? COM1A0 : COM1B0;
+	boolean connected = (((TCCR1A >> shift) & 0x03) != 0) ? TRUE : FALSE;
+
+	g_pwmConnect[channel] = connect;
+	if ((connected != connect) && !(TIMSK & (1 << TOIE1)))
+	{
+		/* Only a TOP after this call: an old overflow flag is cleared */
+		TIFR = (1 << TOV1);
+		TIMSK |= (1 << TOIE1);
+	}
+}
+
+/* Fast PWM: TOP is reached and the buffered compare values are loaded, connect or disconnect the outputs with them */
+ISR(TIMER1_OVF_vect)
+{
+	uint8 channel;
+
+	for (channel = Timer1_Channel_A; channel <= Timer1_Channel_B; channel++)
+	{
+		if (g_pwmOutput[channel] != Timer1_PWM_Disconnected)
+		{
+			Timer1_PWM_Connect(channel, g_pwmConnect[channel]);
+		}
+	}
+	TIMSK &= ~(1 << TOIE1);
+}
 
 /****************************************************************************************
  *                                      Functions Definitions                           *
@@ -32,7 +338,6 @@ static volatile void (*g_callBackPtr)(void) = NULL_PTR;
  */
 void Timer1_NonPWm_Mode_Init(const Timer1_ConfigType * Config_Ptr)
 {
-
 	TCNT1 = Config_Ptr -> initial_value;
 	TCCR1A |= (1<<FOC1A);
 
@@ -60,156 +365,285 @@ void Timer1_NonPWm_Mode_Init(const Timer1_ConfigType * Config_Ptr)
 
 /*
  * Description:
- * The function responsible for trigger the Timer1 with the PWM Mode.
- * 1. Let the TCNT1A Register = The Start value of the timer.
- * 2. Disable FOC1A & FOC1B bits in the TCCR1A Register (FOC1A = 0, FOC1B = 0)
- * 3. Enable CS12:0 bits according to the required pre-scalar.
- * 4. Setup the direction for OC1A as output pin through the GPIO driver.
- * 5. Configuration the PWM Mode (Phase Correct or Fast)
- * 6. Setup the PWM mode with Non-Inverting.
+ * Initialization of Timer1 in a PWM Mode (the whole timer is used, so the time base and the software timers stop):
+ * 1. Compute the pre-scaler and TOP for the required frequency: the smallest pre-scaler whose TOP fits in 16 bits
+ *    (best duty resolution), or the pre-scaler giving the closest period if TOP is fixed by the mode.
+ * 2. Disable the Timer1 interrupts, configure the mode (WGM13:0) and the outputs (COM1A1:0, COM1B1:0).
+ * 3. Put TOP in ICR1 or OCR1A, start with a duty cycle of 0% and configure the used OC1x pins as outputs.
+ * The function will return FALSE (Timer1 is not changed) if the mode is not a PWM mode, OC1A is used with
+ * TOP in OCR1A, or the frequency can not be generated from F_CPU within TIMER1_PWM_TOLERANCE_PERCENT
+ * (with a fixed TOP only 5 frequencies are possible, one per pre-scaler).
  */
-void Timer1_PWM_Mode_Init(const Timer1_ConfigType * Config_Ptr)
+boolean Timer1_PWM_Init(const Timer1_PwmConfigType * Config_Ptr)
 {
+	uint8 sreg = SREG;
+	Timer1_Mode mode = Config_Ptr -> mode;
+	uint32 frequency = Config_Ptr -> frequency;
+	uint32 top = 0;
+	uint32 fixedTop = 0;
+	uint32 divisor;
+	uint32 period;
+	uint32 error;
+	uint32 bestError = 0xFFFFFFFF;
+	boolean fast = FALSE;
+	boolean topInOcr1a = FALSE;
+	uint8 prescaler = No_Clock;
+	uint8 index;
 
-	TCNT1 = Config_Ptr -> initial_value;
-	CLEAR_BIT(TCCR1A, FOC1A);
-	CLEAR_BIT(TCCR1A, FOC1B);
-
-	/* Set to required pre-scalar Configuration*/
-	TCCR1B = (TCCR1B & 0xF8) | (Config_Ptr -> prescaler);
-
-	/* Configure the OC1A pin as Output Pin */
-	GPIO_SetupPinDirection(PORTD_ID, PIN4_ID, OUTPUT_PIN);
-
-	/* Preparing TCCR1A & TCCR1B Registers to configuration according to required Mode */
-	TCCR1A &= 0x3C;      /* TCCR1A & 0011 1100 */
-	TCCR1B &= 0xE7;      /* TCCR1B & 1110 0111 */
-
-	switch(Config_Ptr -> mode)
+	switch (mode)
 	{
 	case PWM_Phase_Correct_8_Bit_1:
-		/* Configuration for Phase Correct PWM 8-bit Mode:
-		 * WGM10 = 1, WGM11 = 0, WGM12 = 0, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
 	case PWM_Phase_Correct_9_Bit_2:
-		/* Configuration for Phase Correct PWM 9-bit Mode:
-		 * WGM10 = 0, WGM11 = 1, WGM12 = 0, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
 	case PWM_Phase_Correct_10_Bit_3:
-		/* Configuration for Phase Correct PWM 10-bit Mode:
-		 * WGM10 = 1, WGM11 = 1, WGM12 = 0, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = 0x00FF, 0x01FF, 0x03FF, f = F_CPU / (2 * N * TOP) */
+		fixedTop = (0x80UL << mode) - 1UL;
 		break;
 
 	case Fast_Pwm_8_Bit_5:
-		/* Configuration for Fast PWM 8-bit Mode:
-		 * WGM10 = 1, WGM11 = 0, WGM12 = 1, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1B, WGM12);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
 	case Fast_Pwm_9_Bit_6:
-		/* Configuration for Fast PWM 9-bit Mode:
-		 * WGM10 = 0, WGM11 = 1, WGM12 = 1, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM12);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
 	case Fast_Pwm_10_Bit_7:
-		/* Configuration for Fast PWM 10-bit Mode:
-		 * WGM10 = 1, WGM11 = 1, WGM12 = 1, WGM13 = 0, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM12);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = 0x00FF, 0x01FF, 0x03FF, f = F_CPU / (N * (1 + TOP)) */
+		fixedTop = (0x08UL << mode) - 1UL;
+		fast = TRUE;
 		break;
 
 	case PWM_Phase_and_Frequency_Correct_8:
-		/* Configuration for Phase Correct and Frequency PWM (ICR1) Mode:
-		 * WGM10 = 0, WGM11 = 0, WGM12 = 0, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
-	case PWM_Phase_and_Frequency_Correct_9:
-		/* Configuration for Phase Correct and Frequency PWM (OCR1A) Mode:
-		 * WGM10 = 1, WGM11 = 0, WGM12 = 0, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
-		break;
-
 	case PWM_Phase_Correct_10:
-		/* Configuration for Phase Correct PWM (ICR1) Mode:
-		 * WGM10 = 0, WGM11 = 1, WGM12 = 0, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = ICR1, f = F_CPU / (2 * N * TOP) */
 		break;
 
+	case PWM_Phase_and_Frequency_Correct_9:
 	case PWM_Phase_Correct_11:
-		/* Configuration for Phase Correct PWM (OCR1A) Mode:
-		 * WGM10 = 1, WGM11 = 1, WGM12 = 0, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = OCR1A, f = F_CPU / (2 * N * TOP) */
+		topInOcr1a = TRUE;
 		break;
 
 	case Fast_PWM_14:
-		/* Configuration for Fast PWM (ICR1) Mode:
-		 * WGM10 = 0, WGM11 = 1, WGM12 = 1, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM12);
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = ICR1, f = F_CPU / (N * (1 + TOP)) */
+		fast = TRUE;
 		break;
 
 	case Fast_PWM_15:
-		/* Configuration for Fast PWM (OCR1A) Mode:
-		 * WGM10 = 1, WGM11 = 1, WGM12 = 1, WGM13 = 1, COM1A1 = 1, COM1A0 = 0
-		 */
-		SET_BIT(TCCR1A, WGM10);
-		SET_BIT(TCCR1A, WGM11);
-		SET_BIT(TCCR1B, WGM12);
-		SET_BIT(TCCR1B, WGM13);
-		SET_BIT(TCCR1A, COM1A1);
+		/* TOP = OCR1A, f = F_CPU / (N * (1 + TOP)) */
+		topInOcr1a = TRUE;
+		fast = TRUE;
 		break;
+
+	default:
+		/* Normal, CTC and reserved modes */
+		return FALSE;
+	}
+
+	if ((frequency == 0) || (frequency > F_CPU) ||
+	    ((topInOcr1a == TRUE) && (Config_Ptr -> output_a != Timer1_PWM_Disconnected)))
+	{
+		return FALSE;
+	}
+
+	for (index = 0; index < (sizeof(g_prescalerValue) / sizeof(g_prescalerValue[0])); index++)
+	{
+		/* CPU cycles of one timer count, a dual slope period counts up and down */
+		divisor = (uint32)g_prescalerValue[index] * ((fast == TRUE) ? 1UL : 2UL);
+		if (fixedTop != 0)
+		{
+			/* Closest period: CPU cycles of a period, (TOP + 1) counts (fast) or 2 * TOP counts (dual slope) */
+			top = divisor * (fixedTop + ((fast == TRUE) ? 1UL : 0UL));
+			period = (F_CPU + (frequency / 2UL)) / frequency;
+			error = (top > period) ? (top - period) : (period - top);
+			if (error < bestError)
+			{
+				bestError = error;
+				prescaler = Prescaler_1 + index;
+			}
+		}
+		else
+		{
+			/* Timer counts of a period (rounded), the same formulas solved for TOP */
+			divisor *= frequency;
+			period = (F_CPU + (divisor / 2UL)) / divisor;
+			top = (fast == TRUE) ? (period - 1UL) : period;
+			if ((period == 0) || (top < TIMER1_PWM_MIN_TOP))
+			{
+				/* The frequency is too high, a bigger pre-scaler makes TOP even smaller */
+				return FALSE;
+			}
+			if (top <= 0xFFFFUL)
+			{
+				prescaler = Prescaler_1 + index;
+				break;
+			}
+		}
+	}
+	if (prescaler == No_Clock)
+	{
+		/* The frequency is too low even with pre-scaler 1024 */
+		return FALSE;
+	}
+	if (fixedTop != 0)
+	{
+		top = fixedTop;
+	}
+
+	/*
+	 * The frequency generated: CPU cycles of a period times the required frequency is F_CPU when it is exact.
+	 * A period longer than 2 / frequency is more than 100% off, so the product fits in 32 bits.
+	 */
+	period = (uint32)g_prescalerValue[prescaler - Prescaler_1] * ((fast == TRUE) ? (top + 1UL) : (2UL * top));
+	if (period > ((2UL * F_CPU) / frequency))
+	{
+		return FALSE;
+	}
+	error = period * frequency;
+	error = (error > F_CPU) ? (error - F_CPU) : (F_CPU - error);
+	if ((error * 100UL) > (F_CPU * TIMER1_PWM_TOLERANCE_PERCENT))
+	{
+		return FALSE;
+	}
+
+	g_pwmTop = (uint16)top;
+	g_pwmFast = fast;
+	g_pwmOutput[Timer1_Channel_A] = Config_Ptr -> output_a;
+	g_pwmOutput[Timer1_Channel_B] = Config_Ptr -> output_b;
+	g_pwmConnect[Timer1_Channel_A] = (fast == TRUE) ? FALSE : TRUE;
+	g_pwmConnect[Timer1_Channel_B] = (fast == TRUE) ? FALSE : TRUE;
+
+	cli();
+	/* Stop the timer in normal mode, so TOP and the compare values are written directly (not buffered) */
+	TCCR1B = 0;
+	TCCR1A = 0;
+	TIMSK &= ~((1 << TICIE1) | (1 << OCIE1A) | (1 << OCIE1B) | (1 << TOIE1));
+	TCNT1 = 0;
+	if (topInOcr1a == TRUE)
+	{
+		OCR1A = (uint16)top;
+	}
+	else
+	{
+		ICR1 = (uint16)top;
+		OCR1A = 0;
+	}
+	OCR1B = 0;
+	TIFR = (1 << ICF1) | (1 << OCF1A) | (1 << OCF1B) | (1 << TOV1);
+
+	/* The mode number is the WGM13:0 value: WGM11:10 in TCCR1A, WGM13:12 in TCCR1B */
+	TCCR1A = (uint8)mode & 0x03;
+	for (index = Timer1_Channel_A; index <= Timer1_Channel_B; index++)
+	{
+		if (g_pwmOutput[index] != Timer1_PWM_Disconnected)
+		{
+			/* The pin keeps the off level while the output is disconnected (0% in fast PWM) */
+			GPIO_WritePin(PORTD_ID, (index == Timer1_Channel_A) ? PIN5_ID : PIN4_ID,
+			              (g_pwmOutput[index] == Timer1_PWM_Inverting) ? LOGIC_HIGH : LOGIC_LOW);
+			GPIO_SetupPinDirection(PORTD_ID, (index == Timer1_Channel_A) ? PIN5_ID : PIN4_ID, OUTPUT_PIN);
+			Timer1_PWM_Connect(index, (fast == TRUE) ? FALSE : TRUE);
+		}
+	}
+	TCCR1B = ((((uint8)mode >> 2) & 0x03) << WGM12) | prescaler;
+	SREG = sreg;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * Set the duty cycle of the channel as the compare value (OCR1A or OCR1B), 0 .. TOP (see Timer1_PWM_GetTop()):
+ * the output changes at the compare match and TOP as described at the data sheet (in fast PWM a compare value
+ * of 0 still gives a pulse of one timer count). The compare registers are double buffered in the PWM modes,
+ * so the new duty cycle starts with the next PWM period and no period is cut (glitch free). In fast PWM an output
+ * disconnected for 0% is connected again at TOP by the overflow interrupt, with the new compare value.
+ * The function will return FALSE if the channel is not a PWM output.
+ */
+boolean Timer1_PWM_SetDuty(Timer1_PwmChannel channel, uint16 compare_value)
+{
+	uint8 sreg = SREG;
+
+	if ((channel > Timer1_Channel_B) || (g_pwmOutput[channel] == Timer1_PWM_Disconnected))
+	{
+		return FALSE;
+	}
+	if (compare_value > g_pwmTop)
+	{
+		compare_value = g_pwmTop;
+	}
+
+	/* A 16-bit register is written through the TEMP register shared by all the 16-bit accesses of Timer1 */
+	cli();
+	if (channel == Timer1_Channel_A)
+	{
+		OCR1A = compare_value;
 	}
+	else
+	{
+		OCR1B = compare_value;
+	}
+	if (g_pwmFast == TRUE)
+	{
+		/* Connected again if it was disconnected for 0% (the dual slope outputs are always connected) */
+		Timer1_PWM_ConnectAtTop(channel, TRUE);
+	}
+	SREG = sreg;
+	return TRUE;
 }
 
 /*
  * Description:
- * Function to
- * 1. calculate the OCR1A Value from required Duty Cycle.
- * 2. Put Compare and TOP values of (ICR1 or OCR1A) registers.
+ * Set the duty cycle of the channel in percent (0 .. 100) of the PWM period, rounded to the nearest timer count.
+ * 0% and 100% are a constant level in all the modes (in fast PWM the output is disconnected for 0%,
+ * the pin then keeps the off level), the other values are glitch free like Timer1_PWM_SetDuty().
+ * In fast PWM the output is disconnected at TOP by the overflow interrupt, so the current pulse is not cut
+ * (the interrupts must be enabled; if the interrupt comes after BOTTOM the compare value 0 is already used,
+ * the next period is a pulse of one timer count).
+ * The function will return FALSE if the channel is not a PWM output.
  */
-void TIMER1_PWM_Start (uint16 Duty_Cycle)
+boolean Timer1_PWM_SetDutyPercent(Timer1_PwmChannel channel, uint8 percent)
 {
-	ICR1 = 2499;
-	OCR1A = Duty_Cycle;
+	uint8 sreg = SREG;
+	uint32 onCounts;
+
+	if ((channel > Timer1_Channel_B) || (g_pwmOutput[channel] == Timer1_PWM_Disconnected))
+	{
+		return FALSE;
+	}
+	if (percent > 100)
+	{
+		percent = 100;
+	}
+
+	if (g_pwmFast == FALSE)
+	{
+		/* Dual slope: the output is on for 2 * OCR1x of the 2 * TOP counts of a period */
+		return Timer1_PWM_SetDuty(channel, (uint16)((((uint32)percent * g_pwmTop) + 50UL) / 100UL));
+	}
+
+	/* Fast PWM: the output is on for OCR1x + 1 of the TOP + 1 counts of a period */
+	onCounts = (((uint32)percent * (g_pwmTop + 1UL)) + 50UL) / 100UL;
+	if (onCounts == 0)
+	{
+		/* Disconnected at the end of this period: the compare value 0 is the shortest pulse if TOP is missed */
+		cli();
+		if (channel == Timer1_Channel_A)
+		{
+			OCR1A = 0;
+		}
+		else
+		{
+			OCR1B = 0;
+		}
+		Timer1_PWM_ConnectAtTop(channel, FALSE);
+		SREG = sreg;
+		return TRUE;
+	}
+	return Timer1_PWM_SetDuty(channel, (uint16)(onCounts - 1UL));
 }
+
+/*
+ * Description:
+ * The function will return TOP computed by the last Timer1_PWM_Init() (the duty cycle resolution).
+ */
+uint16 Timer1_PWM_GetTop(void)
+{
+	return g_pwmTop;
+}
+
 /*
  * Description:
  * Function to disable the Timer1.
@@ -221,12 +655,118 @@ void Timer1_DeInit(void)
 	TIMSK = 0;
 }
 
+/*
+ * Description:
+ * The function will return the number of timer counts elapsed since the beginning of the current tick
+ * (a compare match which is pending but not yet served is counted as a finished tick, so the value
+ * can be up to two ticks). Used to start/stop software activities exactly inside a tick.
+ */
+uint16 Timer1_GetTickPhase(void)
+{
+	uint8 sreg = SREG;
+	uint16 phase;
+
+	cli();
+	phase = TCNT1;
+	if (TIFR & (1 << OCF1A))
+	{
+		/* The tick ended but its ISR did not run yet: read TCNT1 again as it may have just been cleared */
+		phase = TCNT1 + OCR1A + 1;
+	}
+	SREG = sreg;
+	return phase;
+}
+
+/*
+ * Description:
+ * The function will return the time since the Timer1 tick was started in timer counts
+ * (ticks * TIMER1_TICK_COUNTS + tick phase), wrapping around to zero at TIMER1_TIME_WRAP.
+ * The difference of two readings measures a duration with one timer count resolution.
+ */
+uint32 Timer1_GetTime(void)
+{
+	uint8 sreg = SREG;
+	uint16 ticks;
+	uint16 phase;
+
+	/* The tick count and the phase must be read from the same tick */
+	cli();
+	ticks = g_wheelTime;
+	phase = Timer1_GetTickPhase();
+	SREG = sreg;
+	return ((uint32)ticks * TIMER1_TICK_COUNTS) + phase;
+}
+
 /*
  * Description:
  * Function to set the Call Back function address.
+ * The call back function is called from the Timer1 compare match ISR at every tick.
  */
 void Timer1_SetCallBack(void(*a_ptr)(void))
 {
 	g_callBackPtr = a_ptr;
 }
 
+/*
+ * Description:
+ * Start a software timer on the Timer1 tick (CTC_4 mode):
+ * The call back is called from the Timer1 compare match ISR after "period" ticks, once (Timer1_OneShot)
+ * or every "period" ticks (Timer1_Periodic). A period of 0 is handled as 1 tick.
+ * The function takes constant time whatever the number of timers in use and will return the software timer ID,
+ * or TIMER1_INVALID_SOFT_TIMER if all the TIMER1_NUM_OF_SOFT_TIMERS software timers are in use.
+ */
+Timer1_SoftTimerId Timer1_SoftTimer_Start(uint16 period, Timer1_SoftTimerType type, void(*a_ptr)(void))
+{
+	/* The table is shared with the ISR, so it is updated with the interrupts disabled */
+	uint8 sreg = SREG;
+	Timer1_SoftTimerId id = TIMER1_INVALID_SOFT_TIMER;
+
+	if (a_ptr == NULL_PTR)
+	{
+		return TIMER1_INVALID_SOFT_TIMER;
+	}
+	if (period == 0)
+	{
+		period = 1;
+	}
+
+	cli();
+	if (g_softTimerFreeListReady == FALSE)
+	{
+		Timer1_SoftTimer_InitFreeList();
+	}
+	if (g_softTimerFreeHead != TIMER1_INVALID_SOFT_TIMER)
+	{
+		id = g_softTimerFreeHead;
+		g_softTimerFreeHead = g_softTimerNext[id];
+
+		g_softTimerPeriod[id] = period;
+		g_softTimerExpiry[id] = g_wheelTime + period;
+		g_softTimerType[id] = type;
+		g_softTimerCallBack[id] = a_ptr;
+		Timer1_SoftTimer_Insert(id);
+	}
+	SREG = sreg;
+	return id;
+}
+
+/*
+ * Description:
+ * Stop the software timer and release its ID in constant time (also allowed from a call back).
+ * A one-shot software timer is released automatically when it expires, its ID must not be cancelled after that.
+ */
+void Timer1_SoftTimer_Cancel(Timer1_SoftTimerId id)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	if ((id < TIMER1_NUM_OF_SOFT_TIMERS) && (g_softTimerCallBack[id] != NULL_PTR))
+	{
+		Timer1_SoftTimer_Remove(id);
+		g_softTimerCallBack[id] = NULL_PTR;
+		g_softTimerNext[id] = g_softTimerFreeHead;
+		g_softTimerFreeHead = id;
+	}
+	SREG = sreg;
+}
+
@@ -9,6 +9,82 @@
 #ifndef TIMER1_H_
 #define TIMER1_H_
 
+/*******************************************************************************************
+ *                                    Macros Definitions                                   *
+ *******************************************************************************************/
+
+/* Required frequency of the Timer1 compare match interrupt (the time base tick: one millisecond) */
+#ifndef TIMER1_TICK_HZ
+#define TIMER1_TICK_HZ                             1000UL
+#endif
+
+/*
+ * Compile-time selection of the time base from F_CPU:
+ * The smallest pre-scaler which fits one tick in the 16-bit OCR1A is used (best resolution).
+ * One tick is F_CPU / (pre-scaler * TIMER1_TICK_HZ) timer counts, which is usually not an integer:
+ * TIMER1_TICK_COUNTS is the integer part and TIMER1_TICK_REMAINDER / TIMER1_TICK_DIVISOR the fraction.
+ */
+#if   ((F_CPU / (1UL * TIMER1_TICK_HZ)) < 65536UL)
+#define TIMER1_TICK_PRESCALER_VALUE                1UL
+#define TIMER1_TICK_PRESCALER                      Prescaler_1
+#elif ((F_CPU / (8UL * TIMER1_TICK_HZ)) < 65536UL)
+#define TIMER1_TICK_PRESCALER_VALUE                8UL
+#define TIMER1_TICK_PRESCALER                      Prescaler_8
+#elif ((F_CPU / (64UL * TIMER1_TICK_HZ)) < 65536UL)
+#define TIMER1_TICK_PRESCALER_VALUE                64UL
+#define TIMER1_TICK_PRESCALER                      Prescaler_64
+#elif ((F_CPU / (256UL * TIMER1_TICK_HZ)) < 65536UL)
+#define TIMER1_TICK_PRESCALER_VALUE                256UL
+#define TIMER1_TICK_PRESCALER                      Prescaler_256
+#elif ((F_CPU / (1024UL * TIMER1_TICK_HZ)) < 65536UL)
+#define TIMER1_TICK_PRESCALER_VALUE                1024UL
+#define TIMER1_TICK_PRESCALER                      Prescaler_1024
+#else
+#error "TIMER1_TICK_HZ is too low for F_CPU, it does not fit in Timer1 even with pre-scaler 1024"
+#endif
+
+#define TIMER1_TICK_DIVISOR                        (TIMER1_TICK_PRESCALER_VALUE * TIMER1_TICK_HZ)
+#define TIMER1_TICK_COUNTS                         (F_CPU / TIMER1_TICK_DIVISOR)
+#define TIMER1_TICK_REMAINDER                      (F_CPU % TIMER1_TICK_DIVISOR)
+
+/* Compare value (TOP) of the normal tick, a compensated tick is one timer count longer */
+#define TIMER1_TICK_COMPARE_VALUE                  (TIMER1_TICK_COUNTS - 1UL)
+
+#if (TIMER1_TICK_DIVISOR > 65535UL)
+#error "TIMER1_TICK_HZ is too high for the 16-bit drift compensation accumulator"
+#endif
+
+/* Timer1_GetTime() wraps around after this number of timer counts (65536 ticks) */
+#define TIMER1_TIME_WRAP                           (65536UL * TIMER1_TICK_COUNTS)
+
+/* Number of software timers sharing the Timer1 compare match interrupt (statically allocated, up to 255) */
+#ifndef TIMER1_NUM_OF_SOFT_TIMERS
+#define TIMER1_NUM_OF_SOFT_TIMERS                  8
+#endif
+
+#if (TIMER1_NUM_OF_SOFT_TIMERS > 255)
+#error "The software timer ID is 8-bit and 0xFF is reserved for TIMER1_INVALID_SOFT_TIMER"
+#endif
+
+/*
+ * The software timers are kept in a hierarchical timing wheel of 4 levels of 16 slots:
+ * 16^4 ticks cover the whole 16-bit period range.
+ */
+#define TIMER1_WHEEL_BITS                          4
+#define TIMER1_WHEEL_SLOTS                         (1U << TIMER1_WHEEL_BITS)
+#define TIMER1_WHEEL_LEVELS                        4
+
+/* Returned by Timer1_SoftTimer_Start() when all the software timers are in use */
+#define TIMER1_INVALID_SOFT_TIMER                  0xFF
+
+/* The smallest TOP allowed by the hardware in the PWM modes (2-bit resolution) */
+#define TIMER1_PWM_MIN_TOP                         3
+
+/* The largest error of the generated PWM frequency accepted by Timer1_PWM_Init(), in percent (F_CPU <= 20 MHz) */
+#ifndef TIMER1_PWM_TOLERANCE_PERCENT
+#define TIMER1_PWM_TOLERANCE_PERCENT               2
+#endif
+
 /*******************************************************************************************
  *                                      Types Declaration                                  *
  *******************************************************************************************/
@@ -45,6 +121,43 @@ typedef enum
 	Fast_PWM_15
 }Timer1_Mode;
 
+typedef enum
+{
+	Timer1_OneShot,     /* the call back is called once, then the software timer is released */
+	Timer1_Periodic     /* the call back is called every period until the software timer is cancelled */
+}Timer1_SoftTimerType;
+
+/* Identifier of a running software timer, returned by Timer1_SoftTimer_Start() */
+typedef uint8 Timer1_SoftTimerId;
+
+/* PWM output compare channels: OC1A (PD5) and OC1B (PD4) */
+typedef enum
+{
+	Timer1_Channel_A,
+	Timer1_Channel_B
+}Timer1_PwmChannel;
+
+/* COM1x1:0 Bits in TCCR1A Register for the PWM modes */
+typedef enum
+{
+	Timer1_PWM_Disconnected,   /* the pin is a normal GPIO */
+	Timer1_PWM_Non_Inverting = 2, /* the output is high from BOTTOM to the compare match */
+	Timer1_PWM_Inverting       /* the output is low from BOTTOM to the compare match */
+}Timer1_PwmOutput;
+
+/*
+ * frequency: required PWM frequency in Hz, the pre-scaler and TOP are computed from F_CPU.
+ * mode: one of the PWM modes of Timer1_Mode. TOP is fixed in the 8/9/10-bit modes (only the pre-scaler is chosen),
+ *       it is ICR1 (modes 8, 10, 14) or OCR1A (modes 9, 11, 15, OC1A is then not available as a PWM output).
+ * output_a, output_b: OC1A and OC1B pins configuration.
+ */
+typedef struct {
+uint32 frequency;
+Timer1_Mode mode;
+Timer1_PwmOutput output_a;
+Timer1_PwmOutput output_b;
+} Timer1_PwmConfigType;
+
 typedef struct {
 uint16 initial_value;
 uint16 compare_value; /* it will be used in compare mode only. */
@@ -70,23 +183,45 @@ void Timer1_NonPWm_Mode_Init(const Timer1_ConfigType * Config_Ptr);
 
 /*
  * Description:
- * The function responsible for trigger the Timer1 with the PWM Mode.
- * 1. Let the TCNT1A Register = The Start value of the timer.
- * 2. Disable FOC1A & FOC1B bits in the TCCR1A Register (FOC1A = 0, FOC1B = 0)
- * 3. Enable CS12:0 bits according to the required pre-scalar.
- * 4. Setup the direction for OC1A as output pin through the GPIO driver.
- * 5. Configuration the PWM Mode (Phase Correct or Fast)
- * 6. Setup the PWM mode with Non-Inverting.
+ * Initialization of Timer1 in a PWM Mode (the whole timer is used, so the time base and the software timers stop):
+ * 1. Compute the pre-scaler and TOP for the required frequency: the smallest pre-scaler whose TOP fits in 16 bits
+ *    (best duty resolution), or the pre-scaler giving the closest period if TOP is fixed by the mode.
+ * 2. Disable the Timer1 interrupts, configure the mode (WGM13:0) and the outputs (COM1A1:0, COM1B1:0).
+ * 3. Put TOP in ICR1 or OCR1A, start with a duty cycle of 0% and configure the used OC1x pins as outputs.
+ * The function will return FALSE (Timer1 is not changed) if the mode is not a PWM mode, OC1A is used with
+ * TOP in OCR1A, or the frequency can not be generated from F_CPU within TIMER1_PWM_TOLERANCE_PERCENT
+ * (with a fixed TOP only 5 frequencies are possible, one per pre-scaler).
  */
-void Timer1_PWM_Mode_Init(const Timer1_ConfigType * Config_Ptr);
+boolean Timer1_PWM_Init(const Timer1_PwmConfigType * Config_Ptr);
 
 /*
  * Description:
- * Function to
- * 1. calculate the OCR1A Value from required Duty Cycle.
- * 2. Put Compare and TOP values of (ICR1 or OCR1A) registers.
+ * Set the duty cycle of the channel as the compare value (OCR1A or OCR1B), 0 .. TOP (see Timer1_PWM_GetTop()):
+ * the output changes at the compare match and TOP as described at the data sheet (in fast PWM a compare value
+ * of 0 still gives a pulse of one timer count). The compare registers are double buffered in the PWM modes,
+ * so the new duty cycle starts with the next PWM period and no period is cut (glitch free). In fast PWM an output
+ * disconnected for 0% is connected again at TOP by the overflow interrupt, with the new compare value.
+ * The function will return FALSE if the channel is not a PWM output.
  */
-void TIMER1_PWM_Start (uint16 Duty_Cycle);
+boolean Timer1_PWM_SetDuty(Timer1_PwmChannel channel, uint16 compare_value);
+
+/*
+ * Description:
+ * Set the duty cycle of the channel in percent (0 .. 100) of the PWM period, rounded to the nearest timer count.
+ * 0% and 100% are a constant level in all the modes (in fast PWM the output is disconnected for 0%,
+ * the pin then keeps the off level), the other values are glitch free like Timer1_PWM_SetDuty().
+ * In fast PWM the output is disconnected at TOP by the overflow interrupt, so the current pulse is not cut
+ * (the interrupts must be enabled; if the interrupt comes after BOTTOM the compare value 0 is already used,
+ * the next period is a pulse of one timer count).
+ * The function will return FALSE if the channel is not a PWM output.
+ */
+boolean Timer1_PWM_SetDutyPercent(Timer1_PwmChannel channel, uint8 percent);
+
+/*
+ * Description:
+ * The function will return TOP computed by the last Timer1_PWM_Init() (the duty cycle resolution).
+ */
+uint16 Timer1_PWM_GetTop(void);
 
 /*
  * Description:
@@ -94,10 +229,44 @@ void TIMER1_PWM_Start (uint16 Duty_Cycle);
  */
 void Timer1_DeInit(void);
 
+/*
+ * Description:
+ * The function will return the number of timer counts elapsed since the beginning of the current tick
+ * (a compare match which is pending but not yet served is counted as a finished tick, so the value
+ * can be up to two ticks). Used to start/stop software activities exactly inside a tick.
+ */
+uint16 Timer1_GetTickPhase(void);
+
+/*
+ * Description:
+ * The function will return the time since the Timer1 tick was started in timer counts
+ * (ticks * TIMER1_TICK_COUNTS + tick phase), wrapping around to zero at TIMER1_TIME_WRAP.
+ * The difference of two readings measures a duration with one timer count resolution.
+ */
+uint32 Timer1_GetTime(void);
+
 /*
  * Description:
  * Function to set the Call Back function address.
+ * The call back function is called from the Timer1 compare match ISR at every tick.
+ */
+void Timer1_SetCallBack(void(*a_ptr)(void));
+
+/*
+ * Description:
+ * Start a software timer on the Timer1 tick (CTC_4 mode):
+ * The call back is called from the Timer1 compare match ISR after "period" ticks, once (Timer1_OneShot)
+ * or every "period" ticks (Timer1_Periodic). A period of 0 is handled as 1 tick.
+ * The function takes constant time whatever the number of timers in use and will return the software timer ID,
+ * or TIMER1_INVALID_SOFT_TIMER if all the TIMER1_NUM_OF_SOFT_TIMERS software timers are in use.
+ */
+Timer1_SoftTimerId Timer1_SoftTimer_Start(uint16 period, Timer1_SoftTimerType type, void(*a_ptr)(void));
+
+/*
+ * Description:
+ * Stop the software timer and release its ID in constant time (also allowed from a call back).
+ * A one-shot software timer is released automatically when it expires, its ID must not be cancelled after that.
  */
-void Timer1_setCallBack(void(*a_ptr)(void));
+void Timer1_SoftTimer_Cancel(Timer1_SoftTimerId id);
 
 #endif /* TIMER1_H_ */
@@ -0,0 +1,132 @@
+/*******************************************************************************************************************
+ * File Name: Telemetry.c
+ * Date: 16/10/2026
+ * Driver: Stop-Watch Binary Telemetry over UART Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Telemetry.h"
+#include "UART.h"
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * The function will return the time in milliseconds since 00:00:00.000.
+ */
+static uint32 Telemetry_Milliseconds(const StopWatch_TimeType * time)
+{
+	return ((((uint32)time -> hours * 60UL) + time -> minutes) * 60UL + time -> seconds) * 1000UL +
+	       time -> milliseconds;
+}
+
+/*
+ * Description:
+ * Build one record and give it to the UART, the function will return FALSE if it is dropped.
+ */
+static boolean Telemetry_SendRecord(uint8 type, StopWatch_ChannelType channel, uint8 argument, uint32 value)
+{
+	uint8 record[TELEMETRY_RECORD_SIZE];
+	uint8 checksum = 0;
+	uint8 index;
+
+	record[0] = TELEMETRY_SYNC;
+	record[1] = type;
+	record[2] = channel;
+	record[3] = argument;
+	record[4] = (uint8)value;
+	record[5] = (uint8)(value >> 8);
+	record[6] = (uint8)(value >> 16);
+	record[7] = (uint8)(value >> 24);
+	for (index = 1; index < (TELEMETRY_RECORD_SIZE - 1); index++)
+	{
+		checksum ^= record[index];
+	}
+	record[TELEMETRY_RECORD_SIZE - 1] = checksum;
+
+	return UART_Send(record, TELEMETRY_RECORD_SIZE);
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Send the current time of the channel and if it is running.
+ * The telemetry functions are called from main() (the handlers), the UART must be initialized,
+ * they never wait: the function will return FALSE if the record is dropped because the UART buffer is full.
+ */
+boolean Telemetry_SendTime(StopWatch_ChannelType channel)
+{
+	StopWatch_TimeType time;
+
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return FALSE;
+	}
+	StopWatch_GetTime(channel, &time);
+	return Telemetry_SendRecord(TELEMETRY_TIME_RECORD, channel, StopWatch_IsRunning(channel),
+	                            Telemetry_Milliseconds(&time));
+}
+
+/*
+ * Description:
+ * Send a button press with the time of the channel after the press was handled.
+ */
+boolean Telemetry_SendButton(uint8 button, StopWatch_ChannelType channel)
+{
+	StopWatch_TimeType time;
+
+	if (channel >= STOPWATCH_NUM_OF_CHANNELS)
+	{
+		return FALSE;
+	}
+	StopWatch_GetTime(channel, &time);
+	return Telemetry_SendRecord(TELEMETRY_BUTTON_RECORD, channel, button, Telemetry_Milliseconds(&time));
+}
+
+/*
+ * Description:
+ * Send a lap captured on the channel with its time.
+ */
+boolean Telemetry_SendLap(StopWatch_ChannelType channel, uint8 lap, const StopWatch_TimeType * time)
+{
+	if ((channel >= STOPWATCH_NUM_OF_CHANNELS) || (time == NULL_PTR))
+	{
+		return FALSE;
+	}
+	return Telemetry_SendRecord(TELEMETRY_LAP_RECORD, channel, lap, Telemetry_Milliseconds(time));
+}
+
+/*
+ * Description:
+ * Acknowledge a command received over the UART (or TELEMETRY_COMMAND_ERROR if it was not executed)
+ * with the time from the end of the command line to its execution.
+ */
+boolean Telemetry_SendCommand(uint8 command, StopWatch_ChannelType channel, uint32 latency)
+{
+	return Telemetry_SendRecord(TELEMETRY_COMMAND_RECORD, channel, command, latency);
+}
+
+/*
+ * Description:
+ * Send the watchdog fault data: the task which caused the last watchdog reset, the number of watchdog resets
+ * and the missed deadlines of the first (up to 4) tasks.
+ */
+boolean Telemetry_SendFault(uint8 task, uint8 resets, const uint8 * misses, uint8 count)
+{
+	uint32 value = 0;
+	uint8 index;
+
+	if (misses == NULL_PTR)
+	{
+		return FALSE;
+	}
+	for (index = 0; (index < count) && (index < 4); index++)
+	{
+		value |= (uint32)misses[index] << (8 * index);
+	}
+	return Telemetry_SendRecord(TELEMETRY_FAULT_RECORD, task, resets, value);
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************************************************
+ * File Name: Telemetry.h
+ * Date: 16/10/2026
+ * Driver: Stop-Watch Binary Telemetry over UART Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+#include "StopWatch.h"
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * Every record is TELEMETRY_RECORD_SIZE bytes:
+ * [0] TELEMETRY_SYNC
+ * [1] record type (TELEMETRY_TIME_RECORD ...)
+ * [2] stop-watch channel
+ * [3] argument: running flag (time), button number (button), lap number (lap) or command (command)
+ * [4..7] time of the channel in milliseconds since 00:00:00.000, 32-bit little endian,
+ *        for the command record: Timer1 counts from the end of the command line to its execution
+ * [8] checksum: XOR of the bytes 1 .. 7
+ * The fault record is different: [2] the task which caused the last watchdog reset (0xFF if none),
+ * [3] number of watchdog resets, [4..7] missed deadlines of the tasks 0 .. 3 (one byte each, 0 after the last task).
+ */
+#define TELEMETRY_SYNC                             0xA5
+#define TELEMETRY_RECORD_SIZE                      9
+
+#define TELEMETRY_TIME_RECORD                      1
+#define TELEMETRY_BUTTON_RECORD                    2
+#define TELEMETRY_LAP_RECORD                       3
+#define TELEMETRY_COMMAND_RECORD                   4
+#define TELEMETRY_FAULT_RECORD                     5
+
+/* Argument of the command record when the command is not executed */
+#define TELEMETRY_COMMAND_ERROR                    0xFF
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Send the current time of the channel and if it is running.
+ * The telemetry functions are called from main() (the handlers), the UART must be initialized,
+ * they never wait: the function will return FALSE if the record is dropped because the UART buffer is full.
+ */
+boolean Telemetry_SendTime(StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * Send a button press with the time of the channel after the press was handled.
+ */
+boolean Telemetry_SendButton(uint8 button, StopWatch_ChannelType channel);
+
+/*
+ * Description:
+ * Send a lap captured on the channel with its time.
+ */
+boolean Telemetry_SendLap(StopWatch_ChannelType channel, uint8 lap, const StopWatch_TimeType * time);
+
+/*
+ * Description:
+ * Acknowledge a command received over the UART (or TELEMETRY_COMMAND_ERROR if it was not executed)
+ * with the time from the end of the command line to its execution.
+ */
+boolean Telemetry_SendCommand(uint8 command, StopWatch_ChannelType channel, uint32 latency);
+
+/*
+ * Description:
+ * Send the watchdog fault data: the task which caused the last watchdog reset, the number of watchdog resets
+ * and the missed deadlines of the first (up to 4) tasks.
+ */
+boolean Telemetry_SendFault(uint8 task, uint8 resets, const uint8 * misses, uint8 count);
+
+#endif /* TELEMETRY_H_ */
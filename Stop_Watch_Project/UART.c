@@ -0,0 +1,277 @@
+/*******************************************************************************************************************
+ * File Name: UART.c
+ * Date: 16/10/2026
+ * Driver: ATmega32 UART Driver Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "UART.h"
+#include "Profiler.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#if ((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0) || (UART_TX_BUFFER_SIZE > 128)
+#error "UART_TX_BUFFER_SIZE must be a power of two up to 128"
+#endif
+
+#if ((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) != 0) || (UART_RX_BUFFER_SIZE > 128)
+#error "UART_RX_BUFFER_SIZE must be a power of two up to 128"
+#endif
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/*
+ * Transmit buffer: circular buffer emptied by the data register empty ISR (the only consumer, it writes g_txHead only).
+ * The senders (main() and the ISRs) add complete records with the interrupts disabled, so together they are the
+ * single producer (they write g_txTail only). Both indices are free running 8-bit counters (read and written
+ * atomically by the AVR), the number of waiting bytes is g_txTail - g_txHead.
+ */
+static volatile uint8 g_txBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint8 g_txHead = 0;
+static volatile uint8 g_txTail = 0;
+
+static volatile uint16 g_txDropped = 0;
+
+/*
+ * Receive buffer: single producer (the receive complete ISR, it writes g_rxTail only) / single consumer
+ * (UART_Receive() in main(), it writes g_rxHead only) circular buffer without locks, like the transmit buffer.
+ */
+static volatile uint8 g_rxBuffer[UART_RX_BUFFER_SIZE];
+static volatile uint8 g_rxHead = 0;
+static volatile uint8 g_rxTail = 0;
+
+static volatile uint16 g_rxDropped = 0;
+
+/* Global variables to hold the address of the call back function in the application */
+static void (* volatile g_rxCallBackPtr)(uint8 data) = NULL_PTR;
+
+/****************************************************************************************
+ *                                    Interrupt Service Routines                        *
+ ****************************************************************************************/
+
+/* The data register is empty: send the next byte, or stop the interrupt when the buffer is empty */
+ISR(USART_UDRE_vect)
+{
+	PROFILER_ISR_ENTRY();
+	uint8 head = g_txHead;
+
+	if (head != g_txTail)
+	{
+		UDR = g_txBuffer[head & (UART_TX_BUFFER_SIZE - 1)];
+		g_txHead = head + 1;
+	}
+	else
+	{
+		UCSRB &= ~(1 << UDRIE);
+	}
+
+	PROFILER_ISR_EXIT(PROFILER_USART_UDRE_ID);
+}
+
+/* A byte is received: keep it for main() and give it to the application */
+ISR(USART_RXC_vect)
+{
+	PROFILER_ISR_ENTRY();
+	/* The status must be read before UDR (reading UDR moves the receive FIFO) */
+	uint8 status = UCSRA;
+	uint8 data = UDR;
+	uint8 tail = g_rxTail;
+
+	if ((status & (1 << FE)) || ((uint8)(tail - g_rxHead) >= UART_RX_BUFFER_SIZE))
+	{
+		g_rxDropped++;
+	}
+	else
+	{
+		g_rxBuffer[tail & (UART_RX_BUFFER_SIZE - 1)] = data;
+		g_rxTail = tail + 1;
+
+		if (g_rxCallBackPtr != NULL_PTR)
+		{
+			(*g_rxCallBackPtr)(data);
+		}
+	}
+
+	PROFILER_ISR_EXIT(PROFILER_USART_RXC_ID);
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Initialization of the UART:
+ * 1. Empty the transmit and receive buffers.
+ * 2. Enable double speed mode (U2X) and set UBRR for the required baud rate (see UART_UBRR_VALUE()).
+ * 3. Configure the frame format (data bits, parity and stop bits) in UCSRC Register.
+ * 4. Enable the receiver with its receive complete interrupt and the transmitter,
+ *    the data register empty interrupt is enabled only while there are bytes to send.
+ */
+void UART_Init(const UART_ConfigType * Config_Ptr)
+{
+	uint16 ubrr = (uint16)UART_UBRR_VALUE(Config_Ptr -> baud_rate);
+
+	UCSRB = 0;
+	g_txHead = 0;
+	g_txTail = 0;
+	g_txDropped = 0;
+	g_rxHead = 0;
+	g_rxTail = 0;
+	g_rxDropped = 0;
+
+	UCSRA = (1 << U2X);
+
+	/* URSEL = 1 to write UCSRC (it shares the I/O address with UBRRH), asynchronous mode */
+	UCSRC = (1 << URSEL) | ((Config_Ptr -> parity) << UPM0) | ((Config_Ptr -> stop_bit) << USBS) |
+	        ((Config_Ptr -> bit_data) << UCSZ0);
+
+	/* URSEL = 0 to write UBRRH (bits 11:8 of UBRR) */
+	UBRRH = (uint8)(ubrr >> 8) & 0x0F;
+	UBRRL = (uint8)ubrr;
+
+	UCSRB = (1 << RXCIE) | (1 << RXEN) | (1 << TXEN);
+}
+
+/*
+ * Description:
+ * Disable the UART and drop the bytes waiting in the transmit and receive buffers.
+ */
+void UART_DeInit(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	UCSRB = 0;
+	g_txHead = g_txTail;
+	g_rxHead = g_rxTail;
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Copy the bytes to the transmit buffer, they are sent by the data register empty interrupt.
+ * The function never waits: if there is no room for all the bytes nothing is copied, the drop is counted
+ * and the function will return FALSE (so a record is sent complete or not at all).
+ * Can be called from the ISRs and from main().
+ */
+boolean UART_Send(const uint8 * data, uint8 length)
+{
+	uint8 sreg = SREG;
+	uint8 tail;
+	uint8 index;
+
+	/* The interrupts are disabled for the copy of one record only (a few microseconds per byte) */
+	cli();
+	tail = g_txTail;
+	if ((uint8)(UART_TX_BUFFER_SIZE - (uint8)(tail - g_txHead)) < length)
+	{
+		g_txDropped++;
+		SREG = sreg;
+		return FALSE;
+	}
+
+	for (index = 0; index < length; index++)
+	{
+		g_txBuffer[tail & (UART_TX_BUFFER_SIZE - 1)] = data[index];
+		tail++;
+	}
+	g_txTail = tail;
+
+	/* Start the transmission (the interrupt comes as soon as the data register is empty) */
+	UCSRB |= (1 << UDRIE);
+	SREG = sreg;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * The function will return the number of free bytes in the transmit buffer.
+ */
+uint8 UART_GetTxFree(void)
+{
+	return (uint8)(UART_TX_BUFFER_SIZE - (uint8)(g_txTail - g_txHead));
+}
+
+/*
+ * Description:
+ * The function will return the number of bytes sent since UART_Init() as a free running 8-bit counter
+ * (it moves while the transmitter empties the buffer, e.g. to supervise it).
+ */
+uint8 UART_GetTxSent(void)
+{
+	return g_txHead;
+}
+
+/*
+ * Description:
+ * The function will return the number of UART_Send() calls dropped because the transmit buffer was full.
+ */
+uint16 UART_GetTxDropped(void)
+{
+	uint8 sreg = SREG;
+	uint16 txDropped;
+
+	cli();
+	txDropped = g_txDropped;
+	SREG = sreg;
+	return txDropped;
+}
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the receive complete ISR with every byte after it is put in the receive buffer.
+ */
+void UART_SetRxCallBack(void(*a_ptr)(uint8 data))
+{
+	g_rxCallBackPtr = a_ptr;
+}
+
+/*
+ * Description:
+ * Take the oldest received byte from the receive buffer (main() only),
+ * the function will return FALSE if the buffer is empty.
+ */
+boolean UART_Receive(uint8 * data)
+{
+	uint8 head = g_rxHead;
+
+	if (head == g_rxTail)
+	{
+		return FALSE;
+	}
+
+	*data = g_rxBuffer[head & (UART_RX_BUFFER_SIZE - 1)];
+
+	/* Give the slot back to the ISR only after it is read */
+	g_rxHead = head + 1;
+	return TRUE;
+}
+
+/*
+ * Description:
+ * The function will return the number of received bytes waiting in the receive buffer.
+ * Can be called from the ISRs (e.g. the receive call back) and from main().
+ */
+uint8 UART_GetRxCount(void)
+{
+	return (uint8)(g_rxTail - g_rxHead);
+}
+
+/*
+ * Description:
+ * The function will return the number of received bytes dropped because the receive buffer was full
+ * or the byte had a frame error.
+ */
+uint16 UART_GetRxDropped(void)
+{
+	uint8 sreg = SREG;
+	uint16 rxDropped;
+
+	cli();
+	rxDropped = g_rxDropped;
+	SREG = sreg;
+	return rxDropped;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************************************************
+ * File Name: UART.h
+ * Date: 16/10/2026
+ * Driver: ATmega32 UART Driver Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef UART_H_
+#define UART_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* Number of bytes which can wait for the transmission (a power of two, up to 128) */
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE                        64
+#endif
+
+/* Number of received bytes which can wait to be read (a power of two, up to 128) */
+#ifndef UART_RX_BUFFER_SIZE
+#define UART_RX_BUFFER_SIZE                        32
+#endif
+
+/*
+ * UBRR value of a baud rate in double speed mode (U2X = 1), rounded to the nearest integer,
+ * and the real baud rate it gives: the error must be within about 2% for a reliable link.
+ */
+#define UART_UBRR_VALUE(BAUD)                      ((((F_CPU) + (4UL * (BAUD))) / (8UL * (BAUD))) - 1UL)
+#define UART_REAL_BAUD_RATE(BAUD)                  ((F_CPU) / (8UL * (UART_UBRR_VALUE(BAUD) + 1UL)))
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+/* UCSZ2, UCSZ1, UCSZ0 Bits in UCSRB and UCSRC Registers */
+typedef enum
+{
+	UART_5_Bits, UART_6_Bits, UART_7_Bits, UART_8_Bits
+}UART_BitData;
+
+/* UPM1, UPM0 Bits in UCSRC Register */
+typedef enum
+{
+	UART_No_Parity, UART_Even_Parity = 2, UART_Odd_Parity
+}UART_Parity;
+
+/* USBS Bit in UCSRC Register */
+typedef enum
+{
+	UART_1_Stop_Bit, UART_2_Stop_Bits
+}UART_StopBit;
+
+typedef struct {
+uint32 baud_rate;
+UART_BitData bit_data;
+UART_Parity parity;
+UART_StopBit stop_bit;
+} UART_ConfigType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Initialization of the UART:
+ * 1. Empty the transmit and receive buffers.
+ * 2. Enable double speed mode (U2X) and set UBRR for the required baud rate (see UART_UBRR_VALUE()).
+ * 3. Configure the frame format (data bits, parity and stop bits) in UCSRC Register.
+ * 4. Enable the receiver with its receive complete interrupt and the transmitter,
+ *    the data register empty interrupt is enabled only while there are bytes to send.
+ */
+void UART_Init(const UART_ConfigType * Config_Ptr);
+
+/*
+ * Description:
+ * Disable the UART and drop the bytes waiting in the transmit and receive buffers.
+ */
+void UART_DeInit(void);
+
+/*
+ * Description:
+ * Copy the bytes to the transmit buffer, they are sent by the data register empty interrupt.
+ * The function never waits: if there is no room for all the bytes nothing is copied, the drop is counted
+ * and the function will return FALSE (so a record is sent complete or not at all).
+ * Can be called from the ISRs and from main().
+ */
+boolean UART_Send(const uint8 * data, uint8 length);
+
+/*
+ * Description:
+ * The function will return the number of free bytes in the transmit buffer.
+ */
+uint8 UART_GetTxFree(void);
+
+/*
+ * Description:
+ * The function will return the number of bytes sent since UART_Init() as a free running 8-bit counter
+ * (it moves while the transmitter empties the buffer, e.g. to supervise it).
+ */
+uint8 UART_GetTxSent(void);
+
+/*
+ * Description:
+ * The function will return the number of UART_Send() calls dropped because the transmit buffer was full.
+ */
+uint16 UART_GetTxDropped(void);
+
+/*
+ * Description:
+ * Function to set the Call Back function address.
+ * The call back function is called from the receive complete ISR with every byte after it is put in the receive buffer.
+ */
+void UART_SetRxCallBack(void(*a_ptr)(uint8 data));
+
+/*
+ * Description:
+ * Take the oldest received byte from the receive buffer (main() only),
+ * the function will return FALSE if the buffer is empty.
+ */
+boolean UART_Receive(uint8 * data);
+
+/*
+ * Description:
+ * The function will return the number of received bytes waiting in the receive buffer.
+ * Can be called from the ISRs (e.g. the receive call back) and from main().
+ */
+uint8 UART_GetRxCount(void);
+
+/*
+ * Description:
+ * The function will return the number of received bytes dropped because the receive buffer was full
+ * or the byte had a frame error.
+ */
+uint16 UART_GetRxDropped(void);
+
+#endif /* UART_H_ */
@@ -0,0 +1,245 @@
+/*******************************************************************************************************************
+ * File Name: Watchdog.c
+ * Date: 16/10/2026
+ * Driver: Watchdog Supervisor of the Periodic Tasks Source File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Watchdog.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/wdt.h>
+
+#if (WATCHDOG_NUM_OF_TASKS < 1) || (WATCHDOG_NUM_OF_TASKS >= WATCHDOG_NO_TASK)
+#error "WATCHDOG_NUM_OF_TASKS must be 1 .. 254"
+#endif
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/* The fault record is kept in the .noinit section, which the start-up code does not clear */
+#ifndef WATCHDOG_NOINIT
+#define WATCHDOG_NOINIT                            __attribute__((section(".noinit")))
+#endif
+
+/* Written with a valid fault record, the .noinit RAM has a random value after a power-on */
+#define WATCHDOG_FAULT_MAGIC                       0x5744
+
+/***************************************************************************************
+ *                                         Global Variables                            *
+ ***************************************************************************************/
+
+/*
+ * One flag per task: set by Watchdog_CheckIn() (one byte write, atomic) and cleared by Watchdog_Period(),
+ * so the tasks and the supervisor never need to disable the interrupts.
+ */
+static volatile uint8 g_checkIn[WATCHDOG_NUM_OF_TASKS];
+
+/* Deadline of every task in supervisor periods (0 = not supervised) and the periods since its last check-in */
+static volatile uint8 g_deadline[WATCHDOG_NUM_OF_TASKS];
+static uint8 g_silence[WATCHDOG_NUM_OF_TASKS];
+static uint8 g_maxSilence[WATCHDOG_NUM_OF_TASKS];
+
+/* A deadline was missed: the watchdog is not reset any more and the MCU is reset soon */
+static volatile boolean g_faulty = FALSE;
+
+/* Fault record with its checksum and the valid record marker */
+static Watchdog_FaultType g_fault WATCHDOG_NOINIT;
+static uint8 g_faultChecksum WATCHDOG_NOINIT;
+static uint16 g_faultMagic WATCHDOG_NOINIT;
+
+/****************************************************************************************
+ *                                    Private Functions                                 *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * The function will return the checksum (complement of the bytes sum) of the fault record.
+ */
+static uint8 Watchdog_FaultSum(void)
+{
+	const uint8 * bytes = (const uint8 *)&g_fault;
+	uint8 sum = 0;
+	uint8 index;
+
+	for (index = 0; index < sizeof(g_fault); index++)
+	{
+		sum += bytes[index];
+	}
+	return (uint8)~sum;
+}
+
+/****************************************************************************************
+ *                                      Functions Definitions                           *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Initialization of the supervisor:
+ * 1. Validate the fault record kept in the .noinit RAM (clear it if it is not valid, e.g. after a power-on)
+ *    and count the reset in it if the last reset was done by the watchdog (WDRF was set in MCUCSR).
+ * 2. No task is supervised until Watchdog_Supervise() is called.
+ * 3. Start the hardware watchdog with the timeout (WDTO_15MS .. WDTO_2S of <avr/wdt.h>),
+ *    it must be longer than the period of Watchdog_Period().
+ */
+void Watchdog_Init(uint8 timeout, boolean watchdogReset)
+{
+	uint8 sreg = SREG;
+	Watchdog_TaskId task;
+
+	cli();
+	if ((g_faultMagic != WATCHDOG_FAULT_MAGIC) || (g_faultChecksum != Watchdog_FaultSum()))
+	{
+		g_fault.last_task = WATCHDOG_NO_TASK;
+		g_fault.resets = 0;
+		for (task = 0; task < WATCHDOG_NUM_OF_TASKS; task++)
+		{
+			g_fault.misses[task] = 0;
+		}
+		g_faultMagic = WATCHDOG_FAULT_MAGIC;
+	}
+	else if (watchdogReset == FALSE)
+	{
+		/* The last task is about the last watchdog reset only */
+		g_fault.last_task = WATCHDOG_NO_TASK;
+	}
+
+	if (watchdogReset == TRUE)
+	{
+		if (g_fault.resets < 0xFF)
+		{
+			g_fault.resets++;
+		}
+	}
+	g_faultChecksum = Watchdog_FaultSum();
+
+	for (task = 0; task < WATCHDOG_NUM_OF_TASKS; task++)
+	{
+		g_deadline[task] = 0;
+		g_checkIn[task] = FALSE;
+		g_silence[task] = 0;
+		g_maxSilence[task] = 0;
+	}
+	g_faulty = FALSE;
+
+	wdt_enable(timeout);
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Supervise the task: it must check in at least once every deadline periods of Watchdog_Period()
+ * (deadline = 0 stops the supervision of the task, e.g. while the display is turned off).
+ */
+void Watchdog_Supervise(Watchdog_TaskId task, uint8 deadline)
+{
+	uint8 sreg = SREG;
+
+	if (task >= WATCHDOG_NUM_OF_TASKS)
+	{
+		return;
+	}
+
+	/* The supervision starts from a full deadline */
+	cli();
+	g_checkIn[task] = FALSE;
+	g_silence[task] = 0;
+	g_deadline[task] = deadline;
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Report that the task is alive, one byte write (no interrupts disabling), can be called from the ISRs and from main().
+ */
+void Watchdog_CheckIn(Watchdog_TaskId task)
+{
+	if (task < WATCHDOG_NUM_OF_TASKS)
+	{
+		g_checkIn[task] = TRUE;
+	}
+}
+
+/*
+ * Description:
+ * The supervisor, to be called periodically from the Timer1 tick (a periodic software timer):
+ * the hardware watchdog is reset only if every supervised task checked in within its deadline,
+ * otherwise the first task which missed its deadline is recorded in the fault record and the watchdog
+ * is left to reset the MCU.
+ */
+void Watchdog_Period(void)
+{
+	uint8 sreg = SREG;
+	Watchdog_TaskId task;
+
+	cli();
+	for (task = 0; task < WATCHDOG_NUM_OF_TASKS; task++)
+	{
+		if (g_deadline[task] == 0)
+		{
+			continue;
+		}
+
+		if (g_checkIn[task] == TRUE)
+		{
+			g_checkIn[task] = FALSE;
+			g_silence[task] = 0;
+			continue;
+		}
+
+		if (g_silence[task] < 0xFF)
+		{
+			g_silence[task]++;
+		}
+		if (g_silence[task] > g_maxSilence[task])
+		{
+			g_maxSilence[task] = g_silence[task];
+		}
+
+		if ((g_silence[task] >= g_deadline[task]) && (g_faulty == FALSE))
+		{
+			/* Only the first miss is recorded, the MCU is reset before the next timeout */
+			g_faulty = TRUE;
+			g_fault.last_task = task;
+			if (g_fault.misses[task] < 0xFF)
+			{
+				g_fault.misses[task]++;
+			}
+			g_faultChecksum = Watchdog_FaultSum();
+		}
+	}
+
+	if (g_faulty == FALSE)
+	{
+		wdt_reset();
+	}
+	SREG = sreg;
+}
+
+/*
+ * Description:
+ * Health counter of the task: the longest time without a check-in seen since Watchdog_Init(),
+ * in periods of Watchdog_Period() (0 if the task always checked in within one period).
+ */
+uint8 Watchdog_GetMaxSilence(Watchdog_TaskId task)
+{
+	return (task < WATCHDOG_NUM_OF_TASKS) ? g_maxSilence[task] : 0;
+}
+
+/*
+ * Description:
+ * Read the fault record (see Watchdog_FaultType).
+ */
+void Watchdog_GetFaults(Watchdog_FaultType * faults)
+{
+	uint8 sreg = SREG;
+
+	if (faults == NULL_PTR)
+	{
+		return;
+	}
+
+	cli();
+	*faults = g_fault;
+	SREG = sreg;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************************************************
+ * File Name: Watchdog.h
+ * Date: 16/10/2026
+ * Driver: Watchdog Supervisor of the Periodic Tasks Header File
+ * Author: Youssef Zaki
+ ******************************************************************************************************************/
+#include "Standard_Types.h"
+
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+/****************************************************************************************
+ *                                    Macros Definitions                                *
+ ****************************************************************************************/
+
+/*
+ * Number of supervised tasks (the task IDs are 0 .. WATCHDOG_NUM_OF_TASKS-1): the tasks of the application
+ * (main, display and UART), every one of them is sent in the fault telemetry record.
+ */
+#ifndef WATCHDOG_NUM_OF_TASKS
+#define WATCHDOG_NUM_OF_TASKS                      3
+#endif
+
+/* Last task of the fault record when no task missed its deadline before the last reset */
+#define WATCHDOG_NO_TASK                           0xFF
+
+/****************************************************************************************
+ *                                      Types Declaration                               *
+ ****************************************************************************************/
+
+typedef uint8 Watchdog_TaskId;
+
+/*
+ * Fault record, kept in the .noinit RAM, so it survives the watchdog resets (cleared after a power-on):
+ * last_task: the task which missed its deadline before the last watchdog reset, WATCHDOG_NO_TASK if the supervisor
+ *            did not see any (the reset came because Watchdog_Period() itself stopped: the Timer1 tick is stopped
+ *            or the interrupts were kept disabled, e.g. an ISR is stuck).
+ * resets: number of watchdog resets since the power-on (stops at 255).
+ * misses: number of missed deadlines of every task since the power-on (stops at 255).
+ */
+typedef struct {
+uint8 last_task;
+uint8 resets;
+uint8 misses[WATCHDOG_NUM_OF_TASKS];
+} Watchdog_FaultType;
+
+/****************************************************************************************
+ *                                      Functions Prototypes                            *
+ ****************************************************************************************/
+
+/*
+ * Description:
+ * Initialization of the supervisor:
+ * 1. Validate the fault record kept in the .noinit RAM (clear it if it is not valid, e.g. after a power-on)
+ *    and count the reset in it if the last reset was done by the watchdog (WDRF was set in MCUCSR).
+ * 2. No task is supervised until Watchdog_Supervise() is called.
+ * 3. Start the hardware watchdog with the timeout (WDTO_15MS .. WDTO_2S of <avr/wdt.h>),
+ *    it must be longer than the period of Watchdog_Period().
+ */
+void Watchdog_Init(uint8 timeout, boolean watchdogReset);
+
+/*
+ * Description:
+ * Supervise the task: it must check in at least once every deadline periods of Watchdog_Period()
+ * (deadline = 0 stops the supervision of the task, e.g. while the display is turned off).
+ */
+void Watchdog_Supervise(Watchdog_TaskId task, uint8 deadline);
+
+/*
+ * Description:
+ * Report that the task is alive, one byte write (no interrupts disabling), can be called from the ISRs and from main().
+ */
+void Watchdog_CheckIn(Watchdog_TaskId task);
+
+/*
+ * Description:
+ * The supervisor, to be called periodically from the Timer1 tick (a periodic software timer):
+ * the hardware watchdog is reset only if every supervised task checked in within its deadline,
+ * otherwise the first task which missed its deadline is recorded in the fault record and the watchdog
+ * is left to reset the MCU.
+ */
+void Watchdog_Period(void);
+
+/*
+ * Description:
+ * Health counter of the task: the longest time without a check-in seen since Watchdog_Init(),
+ * in periods of Watchdog_Period() (0 if the task always checked in within one period).
+ */
+uint8 Watchdog_GetMaxSilence(Watchdog_TaskId task);
+
+/*
+ * Description:
+ * Read the fault record (see Watchdog_FaultType).
+ */
+void Watchdog_GetFaults(Watchdog_FaultType * faults);
+
+#endif /* WATCHDOG_H_ */